@@ -21,7 +21,23 @@
 
 #include <unordered_map>
 #include <type_traits>
+#include <functional>
+#include <memory>
+#include <cstdint>
+#include <limits>
+#include <exception>
+#include <algorithm>
+#include <span>
+#include <mutex>
 #include "simple_arg_parser_option.hpp"
+#include "simple_arg_parser_option_bitset.hpp"
+#include "simple_arg_parser_flat_key_table.hpp"
+#include "simple_arg_parser_thread_pool.hpp"
+#include "simple_arg_parser_rcu.hpp"
+#include "simple_arg_parser_configuration_source.hpp"
+#include "simple_arg_parser_shared_configuration.hpp"
+#include "simple_arg_parser_argument_vector.hpp"
+#include "simple_arg_parser_schema_index.hpp"
 
 using namespace std::literals::string_view_literals;
 
@@ -32,6 +48,9 @@ namespace SimpleArgParser
     {
         SkipUndeclaredOptions = 0   // Default parsing policy - ignore undefined option keys when parsing
     ,   ForbidUndeclaredOptions = 1 // Throw exception if unknown option key met when parsing
+    ,   SplitKeyValueArguments = 2  // Accept a value attached to an option key with '=' (like --level=3) as the option value
+    ,   ClusterShortSwitches = 4    // Accept a cluster of single character switch keys (like -xvf for -x -v -f)
+    ,   AcceptKeyAbbreviations = 8  // Accept a unique prefix of a long option key (like --verb for --verbose) as the key
     };
 
     inline constexpr ParsingPolicy operator|(ParsingPolicy lhs, ParsingPolicy rhs)
@@ -46,6 +65,98 @@ namespace SimpleArgParser
         return lhs = lhs | rhs;
     }
 
+    inline constexpr bool has_flag(ParsingPolicy policy, ParsingPolicy flag)
+    // Check whether the policy includes the flag
+    {
+        return (static_cast<std::underlying_type_t<ParsingPolicy>>(policy) & static_cast<std::underlying_type_t<ParsingPolicy>>(flag)) != 0;
+    }
+
+    struct MemoryFootprint
+    // Estimated memory footprint of a Parser (see Parser::memory_footprint()). Heap storage owned by option values
+    // themselves (vector items, strings, etc.) is not included.
+    {
+        std::size_t option_count{0};    // Number of options declared
+        std::size_t hot_bytes{0};       // Data used while parsing: dispatch records, flat key table and option bit sets
+        std::size_t cold_bytes{0};      // Option objects (attributes, values, I/O handlers), other indices and tables
+
+        std::size_t total_bytes() const { return hot_bytes + cold_bytes; }
+        std::size_t bytes_per_option() const { return option_count ? total_bytes() / option_count : 0; }
+        std::size_t hot_bytes_per_option() const { return option_count ? hot_bytes / option_count : 0; }
+    };
+
+    class Parser;
+
+    class OptionSnapshot
+    // Immutable copy of the option values of a Parser published with Parser::publish_snapshot(). It may be read from any
+    // thread while the parser itself is updated (by parse(), input() or reload()) on another one.
+    {
+    public:
+
+        template <typename T>
+        const T& get_value(std::string_view) const;
+        // Get the option value by the option key (of the same type as Option::get_value<T>() takes, including SwitchState).
+
+        bool is_specified(std::string_view) const;
+        // Check whether the option had been specified when the snapshot was taken.
+
+        std::uint64_t version() const { return version_; }
+        // Sequence number of the snapshot (starting from 1 for the first one published by the parser).
+
+    private:
+
+        friend class Parser;
+
+        std::size_t get_ordinal_(std::string_view) const;
+        // Get the option ordinal by the key. Throws UndeclaredOptionOrWrongOptionKey for keys unknown to the parser.
+
+        const Parser*               parser_ptr_{nullptr};   // The parser which the snapshot is taken of (for key lookup only)
+        std::uint64_t               version_{0};
+        std::vector<std::any>       values_;                // Copies of the option values (by ordinals)
+        Internals_::OptionBitSet    specified_options_;
+    };
+
+    using SnapshotReadGuard = Internals_::RcuCell<OptionSnapshot>::ReadGuard;
+    // Read access to the snapshot acquired with Parser::acquire_snapshot() (keeps the snapshot alive while it exists).
+
+    template <typename T>
+    class OptionRef
+    // Typed handle of an option value got with Parser::option_ref<T>(key). The option and the value type are validated
+    // when the handle is created, then it's dereferenced directly to the value stored (without key lookup, type check
+    // and exceptions), so it suits hot read paths. The handle stays valid while the Parser exists, and it reads the
+    // value updated by any later parsing (the same way as Option::get_value<T>() does).
+    {
+    public:
+
+        OptionRef() = default;
+
+        const T& get() const noexcept           { return *value_ptr_; }
+        const T& operator*() const noexcept     { return *value_ptr_; }
+        const T* operator->() const noexcept    { return value_ptr_; }
+
+        bool is_specified() const noexcept { return specified_options_ptr_->test(ordinal_); }
+        // Check whether the option has been specified by last parsing.
+
+        explicit operator bool() const noexcept { return value_ptr_ != nullptr; }
+        // False for default constructed handle only.
+
+    private:
+
+        friend class Parser;
+
+        OptionRef(const T* value_ptr, const Internals_::OptionBitSet* specified_options_ptr, std::size_t ordinal)
+        :   value_ptr_(value_ptr)
+        ,   specified_options_ptr_(specified_options_ptr)
+        ,   ordinal_(ordinal)
+        {}
+
+        const T*                        value_ptr_{nullptr};
+        const Internals_::OptionBitSet* specified_options_ptr_{nullptr};   // Specified options of the parser declaring the option
+        std::size_t                     ordinal_{0};
+    };
+
+    using SubcommandParserFactory = std::function<std::unique_ptr<Parser>()>;
+    // Factory constructing a Parser for a subcommand. It's called only when the subcommand is selected in command line.
+
     class Parser
     // The main class for argument parsing.
     // It's initialized with initialization list containing option definitions (objects of Option class).
@@ -54,7 +165,8 @@ namespace SimpleArgParser
     public:
 
         using Options = std::vector<Option>;
-        using OptionSearchTable = std::unordered_map<std::string_view, Option*>;
+        using OptionSearchTable = std::unordered_map<std::string_view, std::uint32_t>; // Name -> option ordinal (cold indices)
+        using SubcommandSearchTable = std::unordered_map<std::string_view, SubcommandParserFactory>;
 
         Parser() = delete;
         Parser(const Parser&) = delete;
@@ -65,6 +177,11 @@ namespace SimpleArgParser
 
         Parser(std::initializer_list<Option>, ParsingPolicy = ParsingPolicy::SkipUndeclaredOptions);
 
+        static constexpr std::size_t DEFAULT_CONVERSION_CHUNK_SIZE{16384};
+        static constexpr std::size_t DEFAULT_ASYNC_INPUT_CONCURRENCY{8};
+        static constexpr std::size_t DEFAULT_KEY_SUGGESTION_DISTANCE{2};
+        static constexpr std::size_t MAX_KEY_SUGGESTIONS{3};
+
         // Option accessors by its key (in its main or short form)
         const Option& operator[](std::string_view) const;
         Option& operator[](std::string_view);
@@ -72,26 +189,332 @@ namespace SimpleArgParser
         // Verify an option definition presense (by option key)
         bool has_option(std::string_view) const;
 
+        // Get the option keys and aliases starting with the prefix (sorted, the ones of the parent parsers not included)
+        std::vector<std::string_view> complete_key(std::string_view) const;
+
+        // Set the maximal edit distance of the declared keys suggested for an undeclared one in ParsingPolicyViolation
+        // (DEFAULT_KEY_SUGGESTION_DISTANCE by default, 0 disables the suggestions). The distance is limited by a third of
+        // the undeclared key length as well, so no keys are suggested for short ones like -x.
+        void set_key_suggestion_distance(std::size_t);
+
+        // Typed handle of the option value for hot read paths (by option key). Throws UndeclaredOptionOrWrongOptionKey if
+        // the option is not declared (regardless of parsing policy) and AccessingValueTypeMismatch if the option value is
+        // not of type T (T is the same as for Option::get_value<T>()).
+        template <typename T>
+        OptionRef<T> option_ref(std::string_view) const;
+
+        // Verify whether the option has been specified by last parsing (by option key)
+        bool is_specified(std::string_view) const;
+
+        // Get the state of switch option (by option key) with a single key lookup and a bit test of packed switch states
+        // (the SwitchState value of the switch mirrors the state, but writing it directly doesn't change the state).
+        // Throws AccessingValueTypeMismatch if the option is not a switch.
+        bool switch_is_on(std::string_view) const;
+
+        // Option constraints checked after parsing (the options are identified by their keys):
+        void add_required_options(std::initializer_list<std::string_view>);
+        // Declare options which must be specified in command line.
+        void add_exclusive_group(std::initializer_list<std::string_view>);
+        // Declare a group of mutually exclusive options (no more than one of them may be specified).
+        void add_dependency(std::string_view, std::initializer_list<std::string_view>);
+        // Declare options which must be specified if the dependent option (the first argument) is specified.
+
         // Parse arguments passed in command line
         int parse(int, const char*[]);
 
+        // Merge option values of several sources (see ConfigurationSource):
+        void merge(std::span<const ConfigurationSource>);
+        // Merge the option values of the sources ordered by precedence (the last one has the highest precedence, like
+        // defaults file, user file, environment, command line). Each option is resolved to its value tokens given by the
+        // highest-precedence source specifying it first, then each option value is converted exactly once (the same way
+        // parse() converts it, so the values of the sources of lower precedence are never converted). Subcommands are not
+        // selected while merging. The option constraints are checked after merging.
+        std::string_view value_source(std::string_view) const;
+        // Get the name of the source which the option value has been taken from by last merge() (by option key).
+        // Returns an empty string if no source has specified the option. A switch set off by an environment source (and
+        // left not specified) refers to that source.
+
+        // Parallel conversion of option values (opt-in):
+        void enable_parallel_conversion(std::size_t worker_count = 0, std::size_t chunk_size = DEFAULT_CONVERSION_CHUNK_SIZE);
+        // Make parse() scan the option keys first (splitting the arguments into per-option value spans), then convert the
+        // values of different options concurrently on a thread pool of worker_count threads (hardware threads minus one
+        // if zero). Vectored values of more than chunk_size single token items are converted in chunks concurrently as well.
+        // The occurrences of the same option are converted in their order, and the error raised is the one that serial
+        // parsing would raise first. Custom inputters and value traits MUST be thread-safe to be used in this mode.
+        // Conversion timings of parser statistics are summed over the threads in this mode (the conversion trace events
+        // of different options may overlap in time).
+        void disable_parallel_conversion();
+        // Make parse() convert option values serially on the calling thread (the default mode).
+
+        void set_async_input_concurrency(std::size_t);
+        // Set the maximal number of AsyncValueInputter<T> tasks run concurrently by parse() (including the calling thread).
+        // The tasks are launched after all the arguments are scanned and joined before parse() returns (even if it fails).
+
+        // Subcommands:
+        void add_subcommand(std::string_view, SubcommandParserFactory);
+        // Declare a subcommand by its name and its parser factory. When parsing, the first token which is neither an option
+        // key nor an option value, but the subcommand name, selects the subcommand: its parser is constructed by the factory
+        // and parses the rest of arguments (with the subcommand name as its argv[0]).
+        // The subcommand parser falls back to the option search table of this parser for the keys it doesn't declare,
+        // so the options common for all subcommands may be declared in this parser only.
+        std::string_view selected_subcommand() const;
+        // Get the name of the subcommand selected by last parsing (or an empty string if there is no one).
+        Parser* selected_subcommand_parser();
+        const Parser* selected_subcommand_parser() const;
+        // Get the parser of the subcommand selected by last parsing (or nullptr if there is no one).
+
         std::ostream& output(std::ostream&) const;
         std::istream& input(std::istream&);
+        // Input the options from the stream of the format output() writes (switches are set on by their keys). The options
+        // input are marked specified on top of the ones specified before: input() applies a partial configuration over the
+        // current values, so it neither clears the specified marks nor checks the option constraints (unlike parse() and
+        // merge(), which take the whole configuration).
+
+        Fingerprint fingerprint() const;
+        // Get the fingerprint of the option values (see simple_arg_parser_fingerprint.hpp): the keys and the values of all
+        // the options (specified or defaulted) in declaration order, followed by the selected subcommand and its options.
+        // It's stable across processes and runs, so it may key caches of results by the effective configuration.
+
+        void export_schema_index(std::ostream&) const;
+        // Export the option schema (the keys, aliases, descriptions and value kinds of the options and the subcommand
+        // names) to a binary index for shell completion (see SchemaIndex). The stream MUST be opened in binary mode.
+
+        ArgumentVector make_argument_vector(std::string_view) const;
+        // Make the command line arguments of a child process (with the program name specified as argv[0]) of the options
+        // specified (switches on only), followed by the selected subcommand and its options. The values are output with
+        // their outputters as separate arguments (not quoted for a shell), so the arguments are parsed back to the same
+        // values, unless a value is output as an option key. The arguments are sized exactly in a first pass and output
+        // to one allocation in a second one.
+
+        std::vector<std::string_view> reload(std::istream&);
+        // Reload the option values from the stream of the same format as input() reads (a configuration file re-read on
+        // SIGHUP, for example) incrementally: the stream is split into per-option value spans (the tokens following each
+        // option key up to the next one, quoted tokens kept whole), and only the options whose spans differ from the ones of
+        // the previous reload are input (so the first reload inputs all the options present). Returns the keys of the options
+        // changed, including the ones which are not present anymore (they become unspecified, switches are set off and
+        // other values are restored to their declared initial values). If an inputter throws, the options input before it keep their new values, but no spans
+        // are stored, so the next reload() compares all the options with the spans of the last successful one (the options
+        // input before the failure are input and reported as changed once again).
+
+        // Parse instrumentation (collected only if SIMPLE_ARG_PARSER_ENABLE_INSTRUMENTATION is defined, see
+        // simple_arg_parser_instrumentation.hpp):
+        ParserStatistics statistics() const;
+        // Get Parser::parse phase timings.
+        std::ostream& output_trace_events(std::ostream&) const;
+        // Output the phase events of last parse() or merge() as Chrome trace-event JSON (loadable with chrome://tracing or
+        // Perfetto). The events are named by the declared option keys (lookups of undeclared keys and switch clusters
+        // are unnamed).
+        void reset_statistics();
+        // Reset statistics of the parser and all its options.
+
+        MemoryFootprint memory_footprint() const;
+        // Get the estimated memory footprint of the parser (for tuning applications with very large option sets).
+
+        // Snapshots of option values for concurrent readers (read-copy-update, see simple_arg_parser_rcu.hpp):
+        void publish_snapshot();
+        // Copy the current option values into a new OptionSnapshot and publish it atomically. Called by the thread which
+        // updates the parser (after parse(), input() or reload()). Blocks until the readers of the previous snapshot
+        // release it, so it MUST NOT be called while the calling thread holds a SnapshotReadGuard of this parser.
+        SnapshotReadGuard acquire_snapshot() const;
+        // Acquire the snapshot published last (wait-free, from any thread). The guard is empty if nothing is published yet.
 
     private:
 
+        friend class Option;
+        friend class OptionSnapshot;
+        friend class ConfigurationSource;
+        friend class SharedConfiguration;
+
         // Internal exception-free option accessors
         const Option* get_option_(std::string_view) const;
         Option* get_option_(std::string_view);
 
+        struct DispatchRecord_
+        // Hot data of an option used while parsing. The records are kept densely in dispatch_records_ (by option ordinals),
+        // so option key lookup and switch dispatch don't touch wide Option objects, which are cold while parsing.
+        {
+            Option*         option_ptr;     // The option itself (attributes, value and I/O handler)
+            Parser*         owner_ptr;      // The parser which the option is declared in
+            std::uint32_t   ordinal;        // Option ordinal in the owner parser
+            bool            is_switch;      // The option is a switch (set on by its key only)
+        };
+
+        const DispatchRecord_* find_dispatch_record_(std::string_view) const;
+        // Find the dispatch record of an option by its key in this parser or its parent parsers (regardless of parsing policy).
+        Option* find_option_(std::string_view);
+        // Find an option by its key in this parser or its parent parsers (regardless of parsing policy).
+        const Option* find_bound_option_(std::string_view, bool&) const;
+        // Find an option by the name of the environment variable bound to it, and tell if its value is a single token.
+
+        struct SortedKey_
+        {
+            std::string_view    key;        // Option key or alias
+            std::uint32_t       ordinal;    // Option ordinal
+        };
+
+        std::span<const SortedKey_> find_keys_with_prefix_(std::string_view) const;
+        // Find the range of the sorted keys of this parser starting with the prefix (by binary search).
+        const DispatchRecord_* find_abbreviated_record_(std::string_view) const;
+        // Find the dispatch record of an option by a unique prefix of its long key in this parser or its parent parsers
+        // (if ParsingPolicy::AcceptKeyAbbreviations is set). Throws AmbiguousOptionKeyAbbreviation if the prefix matches
+        // the keys of several options of the same parser.
+        std::vector<std::string> suggest_option_keys_(std::string_view) const;
+        // Find up to MAX_KEY_SUGGESTIONS declared keys (of this parser and its parent parsers) closest to the undeclared
+        // one by edit distance (for ParsingPolicyViolation thrown).
+
+        void hash_options_(FingerprintHasher&) const;
+        // Feed the option keys and values (and the ones of the selected subcommand) to the hasher for fingerprint().
+        void output_arguments_(std::ostream&, Internals_::ArgumentStreamBuffer&) const;
+        // Output the arguments of the options specified (and the selected subcommand) for make_argument_vector(...).
+
+        bool terminates_option_value_(std::string_view) const;
+        // Check whether an argument terminates the sequence of vectored option value items (an option key or a subcommand name).
+        bool numeric_keys_declared_() const;
+        // Check whether any option key or subcommand name of this parser or its parent parsers looks like a plain number
+        // (otherwise plain number arguments never terminate option values, so their lookups are skipped).
+
+        int parse_serially_(Option::SubrangeOfArgV_&);
+        // Implementation of parse() in serial conversion mode (the default one).
+        int parse_in_parallel_(Option::SubrangeOfArgV_&);
+        // Implementation of parse() in parallel conversion mode (see enable_parallel_conversion()).
+
+        void defer_input_(const Option*, std::size_t, std::function<std::optional<std::string>()>&&);
+        // Defer the input of the option value parsed at the position in argv (see AsyncValueInputter<T>). Thread-safe.
+        void discard_deferred_inputs_(const Option*);
+        // Discard the inputs deferred for the option (since its value is parsed once again). Thread-safe.
+        void run_deferred_inputs_(std::exception_ptr&);
+        // Run the deferred inputs concurrently and join them. If any of them fails before the parsing failure position
+        // (parse_position_), its ValueInputterFailure replaces the parsing failure (to be reported in argv order).
+
+        int parse_subcommand_(std::string_view, Option::SubrangeOfArgV_&);
+        // Construct the parser of the subcommand and parse the rest of arguments with it.
+
+        struct AcceptedArgument_
+        // Result of accepting the argument at option key position
+        {
+            std::string_view        option_key{};           // Option key (the argument itself or its part before '=')
+            const DispatchRecord_*  record{nullptr};        // Dispatch record of the option found by the key (nullptr for undeclared one)
+            const char*             attached_value{nullptr};    // The value attached to the key with '=' (if any)
+            bool                    is_switch_cluster{false};   // The argument is a cluster of short switch keys (like -xvf)
+        };
+
         // Accept next option key provided with SubrangeOfArgV_ object and get the pointer to option by it
-        std::tuple<std::string_view, Option*> accept_next_option_(Option::SubrangeOfArgV_&);
+        AcceptedArgument_ accept_next_option_(Option::SubrangeOfArgV_&);
+
+        int parse_option_(const DispatchRecord_&, Option::SubrangeOfArgV_&);
+        // Parse the option value from the subrange of arguments following its key.
+
+        int parse_switch_cluster_();
+        // Set on all the switches of the cluster (like -xvf) accepted last (by their records resolved while accepting it).
+
+        void set_switch_on_(const DispatchRecord_&);
+        // Fast path for switch options: set the switch state on (and the specified option bit) without calling option's parser.
+        // The switch is instrumented as a conversion of no tokens (by its declared key).
+
+        void set_switch_state_(const DispatchRecord_&, bool);
+        // Set the packed switch state bit and mirror it into the switch's SwitchState value (possibly an external variable).
+
+        void sync_bound_switches_();
+        // Re-read the states of the switches bound to external variables (at the start of parse(), merge(), input() and
+        // reload(), since the application may set the variables between them).
+        bool output_switch_state_(std::size_t) const;
+        // Get the switch state to output (by ordinal): the external variable for a bound switch, the packed bit otherwise.
+
+        const char* find_attached_value_(std::string_view, const DispatchRecord_*&) const;
+        // Split the argument like --key=value (if ParsingPolicy::SplitKeyValueArguments is set). Returns the pointer to
+        // the value (as a suffix of the argument, so without copying) and sets the dispatch record of option found by the key.
+        // Returns nullptr if the argument is not of such form or the key is not declared.
+
+        bool is_switch_cluster_(std::string_view, std::vector<const DispatchRecord_*>* = nullptr) const;
+        // Check whether the argument is a cluster of declared single character switch keys (if ParsingPolicy::ClusterShortSwitches is set).
+        // The records of the switches are put in the vector given (if any), so each character is looked up once.
 
-        Options             options_;               // Options container
-        OptionSearchTable   option_search_table_;   // An index for searching an option by its key
-        ParsingPolicy       parsing_policy_;        // See ParsingPolicy enum class definition
+        Internals_::OptionBitSet make_option_set_(std::initializer_list<std::string_view>) const;
+        // Make a set of options by their keys.
+        std::size_t get_ordinal_(std::string_view) const;
+        // Get the ordinal of this parser's option by its key. Throws UndeclaredOptionOrWrongOptionKey for unknown keys regardless of policy.
+
+        void check_option_constraints_() const;
+        // Check required options, exclusive groups and dependencies against the set of specified options.
+
+        struct OptionDependency_
+        {
+            std::size_t                 dependent_ordinal;
+            Internals_::OptionBitSet    prerequisites;
+        };
+
+        Options                         options_;               // Options container (cold data while parsing)
+        std::vector<DispatchRecord_>    dispatch_records_;      // Hot dispatch data of the options (by ordinals)
+        Internals_::FlatKeyTable        option_search_table_;   // Flat index for searching an option by its key (hot while parsing)
+        std::vector<SortedKey_>         sorted_keys_;           // The keys and aliases sorted (for prefix queries)
+        OptionSearchTable               environment_search_table_;  // An index of environment variables bound to options (by names)
+        ParsingPolicy                   parsing_policy_;        // See ParsingPolicy enum class definition
+        std::size_t                     key_suggestion_distance_{DEFAULT_KEY_SUGGESTION_DISTANCE};  // See set_key_suggestion_distance()
+
+        SubcommandSearchTable   subcommand_search_table_;   // Subcommand parser factories by subcommand names
+        std::string_view        selected_subcommand_;       // Name of the subcommand selected by last parsing
+        std::unique_ptr<Parser> subcommand_parser_;         // Parser of the subcommand selected by last parsing
+        Parser*                 parent_parser_{nullptr};    // Parser which this one is the subcommand parser of
+        bool                    has_numeric_keys_{false};   // Any option key or subcommand name looks like a plain number
+
+        std::vector<const DispatchRecord_*> switch_cluster_records_;    // Records of the switches of the cluster accepted last
+
+        Internals_::OptionBitSet                specified_options_;     // Options specified by last parsing (by ordinals)
+        Internals_::OptionBitSet                switch_states_;         // Packed states of switch options (by ordinals)
+        std::vector<std::uint32_t>              bound_switch_ordinals_; // Switches bound to external variables
+        Internals_::OptionBitSet                required_options_;      // Options which must be specified
+        std::vector<Internals_::OptionBitSet>   exclusive_groups_;      // Groups of mutually exclusive options
+        std::vector<OptionDependency_>          dependencies_;          // Dependent options with their prerequisites
+
+        std::unique_ptr<Internals_::ThreadPool> conversion_pool_;           // Thread pool of parallel conversion mode (if enabled)
+        std::size_t                             conversion_chunk_size_{0};  // Item count of vectored value chunks converted in parallel
+
+        struct DeferredInput_
+        {
+            const Option*                                   option_ptr;
+            std::size_t                                     position;   // Position of the option key in argv
+            std::function<std::optional<std::string>()>     input;
+        };
+
+        std::vector<DeferredInput_> deferred_inputs_;           // Inputs of AsyncValueInputter<T> deferred by last parsing
+        std::mutex                  deferred_inputs_mutex_;     // Guards deferred_inputs_ in parallel conversion mode
+        std::size_t                 async_input_concurrency_{DEFAULT_ASYNC_INPUT_CONCURRENCY};
+        std::size_t                 parse_position_{0};         // Position in argv of the option key being parsed
+
+        std::vector<std::optional<std::string>> reload_spans_;  // Value spans of the options read by last reload (by ordinals)
+        std::vector<std::any>                   initial_values_; // Declared initial values restored by reload (by ordinals)
+
+        std::vector<std::string>    merged_source_names_;   // Names of the sources merged by last merge()
+        std::vector<std::uint32_t>  value_sources_;         // Indices (plus one) of the sources of option values (by ordinals)
+
+        Internals_::RcuCell<OptionSnapshot> snapshot_cell_;         // Snapshot published last
+        std::uint64_t                       snapshot_version_{0};   // Version of the snapshot published last
+
+        [[no_unique_address]] Internals_::ParserInstrumentation instrumentation_; // Parse statistics keeper (empty if disabled)
     };
 
+    template <typename T>
+    OptionRef<T> Parser::option_ref(std::string_view option_key) const
+    {
+        auto* record{find_dispatch_record_(option_key)};
+
+        if (!record)
+            throw OptionAccessException::UndeclaredOptionOrWrongOptionKey{option_key, std::source_location::current()};
+
+        return {&record->option_ptr->template get_value<T>(), &record->owner_ptr->specified_options_, record->ordinal};
+    }
+
+    template <typename T>
+    const T& OptionSnapshot::get_value(std::string_view option_key) const
+    {
+        auto* value_ptr{std::any_cast<T>(&values_[get_ordinal_(option_key)])};
+
+        if (!value_ptr)
+            throw OptionAccessException::AccessingValueTypeMismatch{std::source_location::current()};
+
+        return *value_ptr;
+    }
+
     std::ostream& operator<<(std::ostream&, const Parser&);
     std::istream& operator>>(std::istream&, Parser&);
 }
@@ -0,0 +1,92 @@
+// Copyright 2025 arkanarian-a
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is furnished
+// to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef SIMPLE_ARG_PARSER_ARGUMENT_VECTOR_HPP
+#define SIMPLE_ARG_PARSER_ARGUMENT_VECTOR_HPP
+
+#include <memory>
+#include <cstddef>
+#include <streambuf>
+
+
+namespace SimpleArgParser
+{
+    class Parser;
+
+    class ArgumentVector
+    // Command line arguments made by Parser::make_argument_vector(...) for a child process: the array of argument pointers
+    // terminated with nullptr (argv[0] is the program name) and the characters of the arguments, kept in one allocation.
+    {
+    public:
+
+        ArgumentVector() = default;
+
+        int argc() const { return argument_count_; }
+
+        char* const* argv() const { return storage_.get(); }
+        // Get the arguments for execv(...) or posix_spawn(...).
+        const char** const_argv() const { return const_cast<const char**>(storage_.get()); }
+        // Get the arguments for Parser::parse(...).
+
+    private:
+
+        friend class Parser;
+
+        std::unique_ptr<char*[]>    storage_;               // Argument pointers followed by argument characters
+        int                         argument_count_{0};
+    };
+
+    namespace Internals_
+    {
+        class ArgumentStreamBuffer: public std::streambuf
+        // Stream buffer making command line arguments of the characters output: each '\0' output terminates an argument,
+        // and so do the unquoted spaces of value items of several tokens (see set_item_token_count(...)). Without the
+        // buffers specified it only counts the characters and the arguments (for sizing the buffers exactly).
+        {
+        public:
+
+            ArgumentStreamBuffer(char** arguments = nullptr, char* characters = nullptr) : arguments_(arguments), characters_(characters) {}
+
+            void set_item_token_count(std::size_t item_token_count) { item_token_count_ = item_token_count; }
+            // Set the number of tokens the value items output next consist of (1 by default).
+
+            std::size_t character_count() const { return character_count_; }
+            std::size_t argument_count() const { return argument_count_; }
+
+        protected:
+
+            int_type overflow(int_type) override;
+            std::streamsize xsputn(const char*, std::streamsize) override;
+
+        private:
+
+            void put_(char);
+
+            char**      arguments_;
+            char*       characters_;
+            std::size_t character_count_{0};
+            std::size_t argument_count_{0};
+            std::size_t argument_begin_{0};     // Position of the argument being output
+            std::size_t item_token_count_{1};
+            std::size_t item_tokens_ended_{0};  // Number of the tokens of the item being output ended by spaces
+            char        quote_mark_{'\0'};      // Quote mark of the quoted part of the item being output
+        };
+    }
+}
+
+#endif // SIMPLE_ARG_PARSER_ARGUMENT_VECTOR_HPP
@@ -0,0 +1,84 @@
+// Copyright 2025 arkanarian-a
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is furnished
+// to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef SIMPLE_ARG_PARSER_BULK_CONVERSION_HPP
+#define SIMPLE_ARG_PARSER_BULK_CONVERSION_HPP
+
+// This file contains the helpers of bulk conversion of large vectored values: the plain number check, which lets the
+// parser skip the key lookups of typical value items (the items are then converted in a row by OptionIOImpl::input_tokens).
+
+#include <string_view>
+
+
+namespace SimpleArgParser::Internals_
+{
+// ------------
+// Declarations
+// ------------
+    bool is_plain_number(std::string_view);
+    // Check whether the token is a plain decimal number: [+-]digits[.digits][(e|E)[+-]digits] (with at least one digit
+    // in the mantissa). Such tokens are neither option keys nor subcommand names usually (see Parser::terminates_option_value_).
+
+
+// -----------
+// Definitions
+// -----------
+    inline bool is_plain_number(std::string_view token)
+    {
+        auto first{token.data()}, last{token.data() + token.size()};
+
+        auto skip_digits = [&first, last] ()
+        {
+            auto start{first};
+
+            while (first != last && *first >= '0' && *first <= '9')
+                ++first;
+
+            return first - start;
+        };
+
+        if (first != last && (*first == '+' || *first == '-'))
+            ++first;
+
+        auto mantissa_digits{skip_digits()};
+
+        if (first != last && *first == '.')
+        {
+            ++first;
+            mantissa_digits+=skip_digits();
+        }
+
+        if (mantissa_digits == 0)
+            return false;
+
+        if (first != last && (*first == 'e' || *first == 'E'))
+        {
+            ++first;
+
+            if (first != last && (*first == '+' || *first == '-'))
+                ++first;
+
+            if (skip_digits() == 0)
+                return false;
+        }
+
+        return first == last;
+    }
+}
+
+#endif // SIMPLE_ARG_PARSER_BULK_CONVERSION_HPP
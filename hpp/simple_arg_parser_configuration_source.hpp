@@ -0,0 +1,99 @@
+// Copyright 2025 arkanarian-a
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is furnished
+// to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef SIMPLE_ARG_PARSER_CONFIGURATION_SOURCE_HPP
+#define SIMPLE_ARG_PARSER_CONFIGURATION_SOURCE_HPP
+
+#include <string>
+#include <vector>
+#include <istream>
+#include <cstddef>
+#include <string_view>
+
+
+namespace SimpleArgParser
+{
+    class Parser;
+
+    class ConfigurationSource
+    // A source of option values merged by Parser::merge(...): a configuration stream (of the format Parser::input reads),
+    // the environment variables having a name prefix or command line arguments. The source keeps the tokens split
+    // (the command line arguments are referred to, not copied), and the values of std::string_view options refer to
+    // them, so such sources MUST outlive the values.
+    {
+    public:
+
+        ConfigurationSource(ConfigurationSource&&) = default;
+        ConfigurationSource(const ConfigurationSource&) = delete;
+
+        ConfigurationSource& operator=(ConfigurationSource&&) = default;
+        ConfigurationSource& operator=(const ConfigurationSource&) = delete;
+
+        static ConfigurationSource from_stream(std::string, std::istream&);
+        // Read the configuration stream named (a file path, for example) and split it into tokens.
+        static ConfigurationSource from_environment(std::string, std::string_view, const char* const* = nullptr);
+        // Take the variables of the environment (the process one, if nullptr) having the name prefix. The rest of a variable
+        // name is mapped to the option key by lower-casing and replacing '_' with '-' (APP_MAX_JOBS=4 with APP_ prefix
+        // becomes --max-jobs 4). A value is split into tokens like a stream, and a switch is on unless its value is empty,
+        // 0, false, off or no (setting a switch off overrides the sources of lower precedence, the switch is left not
+        // specified). The variables not mapped to declared options are skipped regardless of parsing policy.
+        static ConfigurationSource from_arguments(std::string, int, const char*[]);
+        // Take the command line arguments (argv[0] is skipped).
+        static ConfigurationSource from_bound_environment(const Parser&, std::string, const char* const* = nullptr);
+        // Take the variables of the environment (the process one, if nullptr) bound to the options of the parser (see
+        // OptionAttributes::environment_variable). The environment is scanned once, each variable name is looked up in
+        // the index of bound names built by the parser, and the value of a scalar option is referred to in place (as
+        // a single token, like --key=value argument), so the environment MUST NOT be changed while the source is used.
+        // Vectored values are split into tokens like the values of from_environment(...). Switches are treated the same way
+        // (so NAME= sets a switch off), and a scalar variable of empty value is skipped as if it's not set.
+
+        const std::string& name() const { return name_; }
+
+    private:
+
+        friend class Parser;
+
+        struct Entry_
+        // Environment variable mapped: the key token and its value tokens
+        {
+            std::size_t first_token;
+            std::size_t token_count;
+        };
+
+        ConfigurationSource(std::string name) : name_(std::move(name)) {}
+
+        void append_token_(std::string_view);
+        // Append a token copy to the text kept (the token pointers are made by finish_tokens_()).
+        void finish_tokens_();
+        // Make the pointers to the tokens appended (the tokens referring to external text are kept as they are).
+
+        std::string                 name_;
+        std::vector<char>           text_;          // Copies of the tokens (zero terminated)
+        std::vector<const char*>    tokens_;
+        std::vector<Entry_>         entries_;       // Environment variables mapped (empty for other sources)
+        bool                        is_environment_{false};
+    };
+
+    namespace Internals_
+    {
+        std::string_view next_configuration_token(std::string_view&);
+        // Cut the next whitespace separated token from the text (a quoted part of a token may contain whitespaces).
+    }
+}
+
+#endif // SIMPLE_ARG_PARSER_CONFIGURATION_SOURCE_HPP
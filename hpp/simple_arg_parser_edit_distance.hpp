@@ -0,0 +1,59 @@
+// Copyright 2025 arkanarian-a
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is furnished
+// to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef SIMPLE_ARG_PARSER_EDIT_DISTANCE_HPP
+#define SIMPLE_ARG_PARSER_EDIT_DISTANCE_HPP
+
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include <optional>
+#include <string_view>
+
+
+namespace SimpleArgParser::Internals_
+{
+    class BoundedEditDistance
+    // Levenshtein distance from a pattern to texts, bounded by a maximal distance (used for suggesting the declared keys
+    // for an undeclared one). The distance is computed bit-parallel (Myers' algorithm in Hyyrö's formulation for the
+    // distance between whole strings): a column of the dynamic programming matrix is kept as the bit vectors of its
+    // vertical deltas, so each text character costs a few word operations. The patterns longer than a word are
+    // processed by rows of the matrix instead (option keys of more than 64 characters are not typical).
+    {
+    public:
+
+        BoundedEditDistance(std::string_view, std::size_t);
+        // Prepare the pattern (it MUST outlive the object) and the maximal distance.
+
+        std::optional<std::size_t> operator()(std::string_view) const;
+        // Get the distance from the pattern to the text if it doesn't exceed the maximal distance.
+
+    private:
+
+        static constexpr std::size_t WORD_BITS{64};
+
+        std::optional<std::size_t> compute_by_columns_(std::string_view) const;
+        std::optional<std::size_t> compute_by_rows_(std::string_view) const;
+
+        std::string_view                    pattern_;
+        std::size_t                         max_distance_;
+        std::array<std::uint64_t, 256>      match_masks_{};     // Bits of the pattern positions by characters
+    };
+}
+
+#endif // SIMPLE_ARG_PARSER_EDIT_DISTANCE_HPP
@@ -0,0 +1,161 @@
+// Copyright 2025 arkanarian-a
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is furnished
+// to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef SIMPLE_ARG_PARSER_ENUM_VALUE_TRAITS_HPP
+#define SIMPLE_ARG_PARSER_ENUM_VALUE_TRAITS_HPP
+
+// This file contains ValueTraits<E> for enumerations E having a name table (see EnumNameTable<E> below).
+//
+// To make an enumeration usable as option value type, specialize EnumNameTable<E> with the array of name-value pairs:
+//
+//     enum class LogLevel { Debug, Info, Warning, Error };
+//
+//     template <>
+//     struct SimpleArgParser::EnumNameTable<LogLevel>
+//     {
+//         static constexpr std::array entries
+//         {
+//             SimpleArgParser::EnumName{"debug", LogLevel::Debug}
+//         ,   SimpleArgParser::EnumName{"info", LogLevel::Info}
+//         ,   SimpleArgParser::EnumName{"warning", LogLevel::Warning}
+//         ,   SimpleArgParser::EnumName{"error", LogLevel::Error}
+//         };
+//     };
+//
+// The table is sorted at compile time (by names for input and by values for output), and both input and output are
+// binary searches in sorted arrays, performed without any allocations. Several names may refer to the same value
+// (the first of them in the entries array is used for output), but duplicated names are rejected at compile time.
+// On input failure the error message lists all the valid names.
+
+#include <array>
+#include <string>
+#include <utility>
+#include <algorithm>
+#include <string_view>
+#include <type_traits>
+#include "simple_arg_parser_iostream_handlers.hpp"
+
+
+namespace SimpleArgParser
+{
+// ------------
+// Declarations
+// ------------
+    template <typename E>
+    struct EnumName
+    // A name-value pair of enumeration name table.
+    {
+        std::string_view    name;
+        E                   value;
+    };
+
+    template <typename E>
+    struct EnumNameTable;
+    // Name table of enumeration E. MUST be specialized with 'static constexpr std::array<EnumName<E>, N> entries' member.
+
+    template <typename E>
+    concept IsNamedEnum = std::is_enum_v<E> && requires { EnumNameTable<E>::entries; };
+    // Enumerations having name tables (and so ValueTraits<E> below).
+
+    namespace Internals_
+    {
+        template <typename E>
+        constexpr auto underlying_value(const EnumName<E>& entry) { return static_cast<std::underlying_type_t<E>>(entry.value); }
+
+        template <typename E, std::size_t N, typename Projection>
+        constexpr std::array<EnumName<E>, N> stable_sorted(std::array<EnumName<E>, N> entries, Projection projection)
+        // Compile-time stable sort (insertion sort, since name tables are small and std::stable_sort is not constexpr).
+        {
+            for (std::size_t i{1}; i < N; ++i)
+            {
+                for (auto j{i}; j > 0 && projection(entries[j]) < projection(entries[j - 1]); --j)
+                    std::swap(entries[j], entries[j - 1]);
+            }
+
+            return entries;
+        }
+
+        template <IsNamedEnum E>
+        struct SortedEnumNames
+        // Compile-time sorted copies of EnumNameTable<E>::entries.
+        {
+            static constexpr auto by_name{stable_sorted(EnumNameTable<E>::entries, [] (const EnumName<E>& entry) { return entry.name; })};
+            static constexpr auto by_value{stable_sorted(EnumNameTable<E>::entries, &underlying_value<E>)};
+
+            static_assert
+            (
+                std::ranges::adjacent_find(by_name, {}, &EnumName<E>::name) == by_name.end()
+            ,   "EnumNameTable<E>::entries contains duplicated names"
+            );
+        };
+    }
+
+    template <IsNamedEnum E>
+    struct ValueTraits<E>: public TypeIndependentValueTraits
+    // Value traits of enumeration having a name table. The value is represented by its name.
+    {
+        std::optional<std::string> output(std::ostream& os, E value) const
+        {
+            const auto& by_value{Internals_::SortedEnumNames<E>::by_value};
+
+            auto underlying{static_cast<std::underlying_type_t<E>>(value)};
+            auto found{std::ranges::lower_bound(by_value, underlying, {}, &Internals_::underlying_value<E>)};
+
+            if (found == by_value.end() || found->value != value)
+                return std::format("Enumeration value {} has no name!", underlying);
+
+            os << found->name;
+
+            return std::nullopt;
+        }
+
+        std::optional<std::string> input(std::istream& is, E& value) const
+        {
+            std::string token;
+
+            if (!(is >> token))
+                return "Failed to read enumeration value name from std::istream!";
+
+            return input_token(token, value);
+        }
+
+        std::optional<std::string> input_token(std::string_view token, E& value) const
+        // Allocation-free on success.
+        {
+            const auto& by_name{Internals_::SortedEnumNames<E>::by_name};
+
+            auto found{std::ranges::lower_bound(by_name, token, {}, &EnumName<E>::name)};
+
+            if (found == by_name.end() || found->name != token)
+            {
+                std::string valid_names;
+
+                for (const auto& entry : EnumNameTable<E>::entries)
+                    valid_names.append(valid_names.empty() ? "" : ", ").append(entry.name);
+
+                return std::format("Invalid value '{}'! Valid values are: {}.", token, valid_names);
+            }
+
+            value = found->value;
+
+            return std::nullopt;
+        }
+    };
+}
+
+#endif // SIMPLE_ARG_PARSER_ENUM_VALUE_TRAITS_HPP
@@ -21,6 +21,8 @@
 
 #include <source_location>
 #include <string>
+#include <vector>
+#include <utility>
 #include <exception>
 #include <format>
 #include <ostream>
@@ -78,6 +80,13 @@ namespace SimpleArgParser
             : OptionException(std::format("Scalar option '{}' must follow a value when specified in command line!", option_key), sl)
             {}
         };
+
+        struct AttachedValueNotConsumed: public OptionException
+        {
+            AttachedValueNotConsumed(std::string_view option_key, const std::source_location sl)
+            : OptionException(std::format("Option '{}' takes no value, but the value is attached to its key with '='!", option_key), sl)
+            {}
+        };
     }
 
     namespace OptionAccessException
@@ -147,18 +156,109 @@ namespace SimpleArgParser
                 )
             {}
         };
+
+        struct ValueItemIndexOutOfRange: public OptionException
+        {
+            ValueItemIndexOutOfRange(std::string_view option_key, std::size_t item_index, std::size_t item_count, const std::source_location sl)
+            :   OptionException(std::format("Item index {} is out of the range of option '{}' value items (of {})!", item_index, option_key, item_count), sl)
+            {}
+        };
+    }
+
+    namespace SharedConfigurationException
+    {
+        struct SegmentOperationFailure: public OptionException
+        {
+            SegmentOperationFailure(std::string_view segment_name, std::string_view operation, std::string_view cause, const std::source_location sl)
+            :   OptionException(std::format("Shared memory segment '{}' operation '{}' failed by cause of: '{}'!", segment_name, operation, cause), sl)
+            {}
+        };
+
+        struct SegmentLayoutMismatch: public OptionException
+        {
+            SegmentLayoutMismatch(std::string_view segment_name, const std::source_location sl)
+            :   OptionException(std::format("Shared memory segment '{}' has no option values of known layout!", segment_name), sl)
+            {}
+        };
+    }
+
+    namespace SchemaIndexException
+    {
+        struct IndexFileFailure: public OptionException
+        {
+            IndexFileFailure(std::string_view index_path, std::string_view operation, std::string_view cause, const std::source_location sl)
+            :   OptionException(std::format("Schema index file '{}' operation '{}' failed by cause of: '{}'!", index_path, operation, cause), sl)
+            {}
+        };
+
+        struct IndexLayoutMismatch: public OptionException
+        {
+            IndexLayoutMismatch(std::string_view index_path, const std::source_location sl)
+            :   OptionException(std::format("Schema index file '{}' has no option schema of known layout!", index_path), sl)
+            {}
+        };
     }
 
     namespace ParserException
     {
         struct ParsingPolicyViolation: public OptionException
         {
-            ParsingPolicyViolation(std::string_view undeclared_option_key, const std::source_location sl)
+            ParsingPolicyViolation(std::string_view undeclared_option_key, std::vector<std::string> suggestions, const std::source_location sl)
             :   OptionException
                 (
-                    std::format("Undeclared option key '{}' met when ParsingPolicy::ForbidUndeclaredOptions set!", undeclared_option_key)
+                    std::format("Undeclared option key '{}' met when ParsingPolicy::ForbidUndeclaredOptions set!{}", undeclared_option_key, format_suggestions_(suggestions))
                 ,   sl
                 )
+            ,   suggested_option_keys(std::move(suggestions))
+            {}
+
+            const std::vector<std::string> suggested_option_keys; // Declared keys closest to the undeclared one (see Parser::set_key_suggestion_distance)
+
+        private:
+
+            static std::string format_suggestions_(const std::vector<std::string>& suggestions)
+            {
+                std::string formatted;
+
+                for (std::size_t suggestion_index{0}; suggestion_index < suggestions.size(); ++suggestion_index)
+                    formatted+=std::format("{}'{}'", suggestion_index == 0 ? " Did you mean " : suggestion_index + 1 < suggestions.size() ? ", " : " or ", suggestions[suggestion_index]);
+
+                return formatted.empty() ? formatted : formatted + "?";
+            }
+        };
+
+        struct AmbiguousOptionKeyAbbreviation: public OptionException
+        {
+            AmbiguousOptionKeyAbbreviation(std::string_view abbreviation, std::string_view candidate_keys, const std::source_location sl)
+            :   OptionException(std::format("Option key abbreviation '{}' is ambiguous (it may stand for {})!", abbreviation, candidate_keys), sl)
+            {}
+        };
+
+        struct RequiredOptionMissing: public OptionException
+        {
+            RequiredOptionMissing(std::string_view option_key, const std::source_location sl)
+            :   OptionException(std::format("Required option '{}' is not specified!", option_key), sl)
+            {}
+        };
+
+        struct ExclusiveOptionsSpecified: public OptionException
+        {
+            ExclusiveOptionsSpecified(std::string_view option_key, std::string_view another_option_key, const std::source_location sl)
+            :   OptionException(std::format("Mutually exclusive options '{}' and '{}' are specified together!", option_key, another_option_key), sl)
+            {}
+        };
+
+        struct OptionDependencyViolation: public OptionException
+        {
+            OptionDependencyViolation(std::string_view option_key, std::string_view prerequisite_option_key, const std::source_location sl)
+            :   OptionException(std::format("Option '{}' requires option '{}' to be specified as well!", option_key, prerequisite_option_key), sl)
+            {}
+        };
+
+        struct SubcommandParserConstructionFailure: public OptionException
+        {
+            SubcommandParserConstructionFailure(std::string_view subcommand, const std::source_location sl)
+            :   OptionException(std::format("Parser factory of subcommand '{}' returned no parser!", subcommand), sl)
             {}
         };
     }
@@ -0,0 +1,205 @@
+// Copyright 2025 arkanarian-a
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is furnished
+// to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef SIMPLE_ARG_PARSER_FINGERPRINT_HPP
+#define SIMPLE_ARG_PARSER_FINGERPRINT_HPP
+
+// This file contains FingerprintHasher, the incremental hasher of option values used by Parser::fingerprint().
+//
+// The hasher runs two XXH64 streams (of different seeds) over the same bytes, giving a 128-bit fingerprint (the first
+// stream alone is the 64-bit one). The values are fed in a canonical binary form, so the fingerprint is stable across
+// processes, runs and platforms: integers and enumerations in little-endian byte order of their size, floating point
+// values by their bit patterns, strings by their sizes and bytes, durations and time points by their tick counts.
+// The values of other types are hashed by ValueTraits<T>::hash(FingerprintHasher&, const T&) const if it's provided,
+// or by the text their outputters produce otherwise.
+
+#include <bit>
+#include <array>
+#include <chrono>
+#include <string>
+#include <limits>
+#include <cstdint>
+#include <cstddef>
+#include <streambuf>
+#include <string_view>
+#include <type_traits>
+
+
+namespace SimpleArgParser
+{
+// ------------
+// Declarations
+// ------------
+    struct Fingerprint
+    // 128-bit fingerprint (the low half is the 64-bit one)
+    {
+        std::uint64_t low{0};
+        std::uint64_t high{0};
+
+        bool operator==(const Fingerprint&) const = default;
+    };
+
+    namespace Internals_
+    {
+        class Xxh64
+        // Streaming XXH64 hash
+        {
+        public:
+
+            explicit Xxh64(std::uint64_t);
+
+            void update(const std::byte*, std::size_t);
+            std::uint64_t digest() const;
+
+        private:
+
+            std::array<std::uint64_t, 4>    accumulators_;
+            std::array<std::byte, 32>       stripe_;            // Bytes not consumed yet (less than a stripe)
+            std::size_t                     stripe_size_{0};
+            std::uint64_t                   total_size_{0};
+            std::uint64_t                   seed_;
+        };
+    }
+
+    class FingerprintHasher
+    // Incremental hasher of option values (see the comments above). ValueTraits<T>::hash(...) hooks feed it with the
+    // members of user type values.
+    {
+    public:
+
+        FingerprintHasher();
+
+        void update(const void*, std::size_t);
+        // Feed raw bytes.
+
+        template <typename T>
+        requires (std::is_integral_v<T> && !std::is_same_v<T, bool>) || std::is_enum_v<T>
+        void update_integer(T);
+        // Feed an integer (or an enumeration value) in little-endian byte order.
+        template <typename T>
+        requires std::is_floating_point_v<T>
+        void update_floating(T);
+        // Feed a float or a double by its bit pattern (other floating point types by their value rounded to double).
+        void update_string(std::string_view);
+        // Feed a string size and its bytes.
+
+        std::uint64_t digest64() const { return low_.digest(); }
+        Fingerprint digest128() const { return {low_.digest(), high_.digest()}; }
+
+    private:
+
+        Internals_::Xxh64 low_;
+        Internals_::Xxh64 high_;
+    };
+
+    namespace Internals_
+    {
+        template <typename T>
+        struct IsChronoValue: std::false_type {};
+
+        template <typename Rep, typename Period>
+        struct IsChronoValue<std::chrono::duration<Rep, Period>>: std::true_type {};
+
+        template <typename Clock, typename Duration>
+        struct IsChronoValue<std::chrono::time_point<Clock, Duration>>: std::true_type {};
+
+        template <typename T>
+        concept IsBinaryHashable =
+            std::is_integral_v<T>
+        ||  std::is_enum_v<T>
+        ||  std::is_floating_point_v<T>
+        ||  std::is_same_v<T, std::string>
+        ||  std::is_same_v<T, std::string_view>
+        ||  IsChronoValue<T>::value;
+        // Types hashed in canonical binary form (without ValueTraits<T>::hash hook).
+
+        template <IsBinaryHashable T>
+        void hash_binary_value(FingerprintHasher&, const T&);
+
+        class FingerprintStreamBuffer: public std::streambuf
+        // Stream buffer feeding the characters output to the hasher (for the values hashed by their outputters)
+        {
+        public:
+
+            explicit FingerprintStreamBuffer(FingerprintHasher& hasher) : hasher_(hasher) {}
+
+            std::uint64_t character_count() const { return character_count_; }
+
+        protected:
+
+            int_type overflow(int_type) override;
+            std::streamsize xsputn(const char*, std::streamsize) override;
+
+        private:
+
+            FingerprintHasher&  hasher_;
+            std::uint64_t       character_count_{0};
+        };
+    }
+
+
+// -----------
+// Definitions
+// -----------
+    template <typename T>
+    requires (std::is_integral_v<T> && !std::is_same_v<T, bool>) || std::is_enum_v<T>
+    void FingerprintHasher::update_integer(T value)
+    {
+        std::array<std::byte, sizeof(T)> bytes;
+        auto bits{static_cast<std::make_unsigned_t<typename std::conditional_t<std::is_enum_v<T>, std::underlying_type<T>, std::type_identity<T>>::type>>(value)};
+
+        for (auto& byte : bytes)
+        {
+            byte = static_cast<std::byte>(bits & 0xff);
+            bits = static_cast<decltype(bits)>(bits >> 8);
+        }
+
+        update(bytes.data(), bytes.size());
+    }
+
+    template <typename T>
+    requires std::is_floating_point_v<T>
+    void FingerprintHasher::update_floating(T value)
+    {
+        if constexpr (sizeof(T) == sizeof(std::uint32_t) && std::numeric_limits<T>::is_iec559)
+            update_integer(std::bit_cast<std::uint32_t>(value));
+        else if constexpr (sizeof(T) == sizeof(std::uint64_t) && std::numeric_limits<T>::is_iec559)
+            update_integer(std::bit_cast<std::uint64_t>(value));
+        else
+            update_floating(static_cast<double>(value)); // <-- the padding bytes of long double are not stable
+    }
+
+    template <Internals_::IsBinaryHashable T>
+    void Internals_::hash_binary_value(FingerprintHasher& hasher, const T& value)
+    {
+        if constexpr (std::is_same_v<T, bool>)
+            hasher.update_integer(static_cast<std::uint8_t>(value));
+        else if constexpr (std::is_integral_v<T> || std::is_enum_v<T>)
+            hasher.update_integer(value);
+        else if constexpr (std::is_floating_point_v<T>)
+            hasher.update_floating(value);
+        else if constexpr (std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>)
+            hasher.update_string(value);
+        else if constexpr (requires { value.time_since_epoch(); })
+            hash_binary_value(hasher, value.time_since_epoch());
+        else
+            hash_binary_value(hasher, value.count());
+    }
+}
+
+#endif // SIMPLE_ARG_PARSER_FINGERPRINT_HPP
@@ -0,0 +1,108 @@
+// Copyright 2025 arkanarian-a
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is furnished
+// to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#ifndef SIMPLE_ARG_PARSER_FLAT_KEY_TABLE_HPP
+#define SIMPLE_ARG_PARSER_FLAT_KEY_TABLE_HPP
+
+#include <vector>
+#include <bit>
+#include <cstdint>
+#include <cstddef>
+#include <functional>
+#include <string_view>
+
+
+namespace SimpleArgParser::Internals_
+{
+    class FlatKeyTable
+    // Open addressing hash table of option keys (and aliases) to option ordinals, kept in a single array of 16-byte slots
+    // (linear probing, no more than 3/4 of the slots used). The keys refer to the option attributes (they are not copied),
+    // and the table is sized once for the keys of the Parser, so it never grows or rehashes.
+    {
+    public:
+
+        static constexpr std::uint32_t NOT_FOUND{static_cast<std::uint32_t>(-1)};
+
+        FlatKeyTable() = default;
+
+        explicit FlatKeyTable(std::size_t max_key_count)
+        :   slots_(std::bit_ceil(max_key_count + max_key_count / 3 + 1))
+        ,   mask_(slots_.size() - 1)
+        {}
+
+        std::size_t size() const { return key_count_; }
+        std::size_t slot_count() const { return slots_.size(); }
+        std::size_t bytes() const { return slots_.capacity() * sizeof(Slot_); }
+
+        void assign(std::string_view key, std::uint32_t ordinal)
+        // Map the key to the ordinal (the ordinal of the key mapped already is replaced).
+        {
+            auto& slot{slots_[find_slot_(key)]};
+
+            if (slot.ordinal == NOT_FOUND)
+            {
+                slot.key_data = key.data();
+                slot.key_size = static_cast<std::uint32_t>(key.size());
+                ++key_count_;
+            }
+
+            slot.ordinal = ordinal;
+        }
+
+        std::uint32_t find(std::string_view key) const
+        // Get the ordinal of the key (or NOT_FOUND).
+        {
+            return slots_.empty() ? NOT_FOUND : slots_[find_slot_(key)].ordinal;
+        }
+
+        bool contains(std::string_view key) const { return find(key) != NOT_FOUND; }
+
+        template <typename F>
+        void for_each(F&& f) const
+        // Call f(key, ordinal) for each key mapped (in no particular order).
+        {
+            for (const auto& slot : slots_)
+                if (slot.ordinal != NOT_FOUND) f(std::string_view{slot.key_data, slot.key_size}, slot.ordinal);
+        }
+
+    private:
+
+        struct Slot_
+        {
+            const char*     key_data{nullptr};
+            std::uint32_t   key_size{0};
+            std::uint32_t   ordinal{NOT_FOUND};     // NOT_FOUND marks an empty slot
+        };
+
+        std::size_t find_slot_(std::string_view key) const
+        // Find the slot of the key or the empty one which ends its probe sequence (there is always an empty slot).
+        {
+            auto slot_index{std::hash<std::string_view>{}(key) & mask_};
+
+            while (slots_[slot_index].ordinal != NOT_FOUND && std::string_view{slots_[slot_index].key_data, slots_[slot_index].key_size} != key)
+                slot_index = (slot_index + 1) & mask_;
+
+            return slot_index;
+        }
+
+        std::vector<Slot_>  slots_;
+        std::size_t         mask_{0};
+        std::size_t         key_count_{0};
+    };
+}
+
+#endif // SIMPLE_ARG_PARSER_FLAT_KEY_TABLE_HPP
@@ -0,0 +1,278 @@
+// Copyright 2025 arkanarian-a
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is furnished
+// to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef SIMPLE_ARG_PARSER_INPLACE_VECTOR_HPP
+#define SIMPLE_ARG_PARSER_INPLACE_VECTOR_HPP
+
+#include <new>
+#include <cstddef>
+#include <algorithm>
+#include <source_location>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <initializer_list>
+#include "simple_arg_parser_vectored_value.hpp"
+
+
+namespace SimpleArgParser
+{
+// ------------
+// Declarations
+// ------------
+    template <std::size_t MIN_ITEMS, std::size_t MAX_ITEMS>
+    struct StaticQuantifier
+    // Compile-time quantifier of value count for vectored option value kept in InplaceVector.
+    // The maximum value count defines the capacity of the InplaceVector.
+    {
+        static_assert(MAX_ITEMS > 0 && MIN_ITEMS <= MAX_ITEMS, "StaticQuantifier requires 0 <= MIN_ITEMS <= MAX_ITEMS and MAX_ITEMS > 0");
+
+        static constexpr std::size_t min_values{MIN_ITEMS}; // min values must be provided for a vectored option
+        static constexpr std::size_t max_values{MAX_ITEMS}; // max values possible to be provided
+    };
+
+    template <typename T, std::size_t CAPACITY>
+    class InplaceVector
+    // Vector of fixed capacity keeping its items inside the object itself (so, without any heap allocations).
+    // It's intended for small vectored option values with compile-time bounded item count (3 coordinates, 4 IP octets, etc.).
+    // Exceeding the capacity raises OptionAccessException::NumberOfItemsSpecifiedExceedsMaximum.
+    {
+        static_assert(CAPACITY > 0, "InplaceVector capacity must be positive");
+
+    public:
+
+        using value_type = T;
+        using size_type = std::size_t;
+        using reference = T&;
+        using const_reference = const T&;
+        using iterator = T*;
+        using const_iterator = const T*;
+
+        InplaceVector() = default;
+        InplaceVector(std::initializer_list<T>);
+        InplaceVector(const InplaceVector&);
+        InplaceVector(InplaceVector&&) noexcept(std::is_nothrow_move_constructible_v<T>);
+        ~InplaceVector() { clear(); }
+
+        InplaceVector& operator=(const InplaceVector&);
+        InplaceVector& operator=(InplaceVector&&) noexcept(std::is_nothrow_move_constructible_v<T>);
+
+        static constexpr size_type capacity() { return CAPACITY; }
+        size_type size() const  { return size_; }
+        bool empty() const      { return size_ == 0; }
+
+        T* data()               { return std::launder(reinterpret_cast<T*>(storage_)); }
+        const T* data() const   { return std::launder(reinterpret_cast<const T*>(storage_)); }
+
+        iterator begin()                { return data(); }
+        iterator end()                  { return data() + size_; }
+        const_iterator begin() const    { return data(); }
+        const_iterator end() const      { return data() + size_; }
+        const_iterator cbegin() const   { return begin(); }
+        const_iterator cend() const     { return end(); }
+
+        reference operator[](size_type index)               { return data()[index]; }
+        const_reference operator[](size_type index) const   { return data()[index]; }
+
+        reference at(size_type index)               { return check_index_(index), data()[index]; }
+        const_reference at(size_type index) const   { return check_index_(index), data()[index]; }
+
+        reference front()               { return data()[0]; }
+        const_reference front() const   { return data()[0]; }
+        reference back()                { return data()[size_ - 1]; }
+        const_reference back() const    { return data()[size_ - 1]; }
+
+        template <typename... Args>
+        reference emplace_back(Args&&...);
+
+        void push_back(const T& value)  { emplace_back(value); }
+        void push_back(T&& value)       { emplace_back(std::move(value)); }
+        void pop_back()                 { std::destroy_at(data() + --size_); }
+
+        void resize(size_type);
+        void clear();
+
+        friend bool operator==(const InplaceVector& lhs, const InplaceVector& rhs)
+        {
+            return lhs.size_ == rhs.size_ && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+        }
+
+    private:
+
+        void check_index_(size_type index) const
+        {
+            if (index >= size_)
+                throw std::out_of_range("InplaceVector index is out of range");
+        }
+
+        alignas(T) std::byte    storage_[CAPACITY * sizeof(T)];
+        size_type               size_{0};
+    };
+
+    namespace Internals_
+    {
+        template <typename T, std::size_t CAPACITY>
+        class InplaceVectoredValue
+        // Wrapper over vectored value kept in InplaceVector<T, CAPACITY>. Has the same interface as VectoredValue<T>,
+        // but its maximal item count is the InplaceVector capacity.
+        {
+        public:
+
+            using value_type = T;
+
+            InplaceVectoredValue(InplaceVector<T, CAPACITY>&&, std::size_t);
+
+            operator InplaceVector<T, CAPACITY>& ()             { return items_; };
+            operator const InplaceVector<T, CAPACITY>& () const { return items_; };
+
+            InplaceVector<T, CAPACITY>& items()             { return items_; }
+            const InplaceVector<T, CAPACITY>& items() const { return items_; }
+
+            std::size_t min_items() const { return min_items_; }
+            std::size_t max_items() const { return CAPACITY; }
+
+        private:
+
+            InplaceVector<T, CAPACITY>  items_;
+            std::size_t                 min_items_;
+        };
+
+        template <typename T, std::size_t CAPACITY>
+        struct IsVector<InplaceVector<T, CAPACITY>>: std::true_type
+        {};
+
+        template <typename T, std::size_t CAPACITY>
+        struct IsVector<InplaceVectoredValue<T, CAPACITY>>: std::true_type
+        {};
+
+        template <typename T, std::size_t CAPACITY>
+        struct VectoredValueFor<InplaceVector<T, CAPACITY>>
+        {
+            using type = InplaceVectoredValue<T, CAPACITY>;
+        };
+
+        template <typename T, std::size_t CAPACITY>
+        struct VectoredValueFor<InplaceVectoredValue<T, CAPACITY>>
+        {
+            using type = InplaceVectoredValue<T, CAPACITY>;
+        };
+    }
+
+
+// -----------
+// Definitions
+// -----------
+    template <typename T, std::size_t CAPACITY>
+    InplaceVector<T, CAPACITY>::InplaceVector(std::initializer_list<T> init_values)
+    {
+        if (init_values.size() > CAPACITY)
+            throw OptionAccessException::NumberOfItemsSpecifiedExceedsMaximum(init_values.size(), CAPACITY, std::source_location::current());
+
+        for (const auto& init_value : init_values)
+            emplace_back(init_value);
+    }
+
+    template <typename T, std::size_t CAPACITY>
+    InplaceVector<T, CAPACITY>::InplaceVector(const InplaceVector& other)
+    {
+        for (const auto& item : other)
+            emplace_back(item);
+    }
+
+    template <typename T, std::size_t CAPACITY>
+    InplaceVector<T, CAPACITY>::InplaceVector(InplaceVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+    {
+        for (auto& item : other)
+            emplace_back(std::move(item));
+    }
+
+    template <typename T, std::size_t CAPACITY>
+    InplaceVector<T, CAPACITY>& InplaceVector<T, CAPACITY>::operator=(const InplaceVector& other)
+    {
+        if (this != &other)
+        {
+            clear();
+
+            for (const auto& item : other)
+                emplace_back(item);
+        }
+
+        return *this;
+    }
+
+    template <typename T, std::size_t CAPACITY>
+    InplaceVector<T, CAPACITY>& InplaceVector<T, CAPACITY>::operator=(InplaceVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+    {
+        if (this != &other)
+        {
+            clear();
+
+            for (auto& item : other)
+                emplace_back(std::move(item));
+        }
+
+        return *this;
+    }
+
+    template <typename T, std::size_t CAPACITY>
+    template <typename... Args>
+    T& InplaceVector<T, CAPACITY>::emplace_back(Args&&... args)
+    {
+        if (size_ == CAPACITY)
+            throw OptionAccessException::NumberOfItemsSpecifiedExceedsMaximum(size_ + 1, CAPACITY, std::source_location::current());
+
+        auto* item{std::construct_at(data() + size_, std::forward<Args>(args)...)};
+
+        ++size_;
+
+        return *item;
+    }
+
+    template <typename T, std::size_t CAPACITY>
+    void InplaceVector<T, CAPACITY>::resize(size_type new_size)
+    {
+        if (new_size > CAPACITY)
+            throw OptionAccessException::NumberOfItemsSpecifiedExceedsMaximum(new_size, CAPACITY, std::source_location::current());
+
+        while (size_ > new_size)
+            pop_back();
+
+        while (size_ < new_size)
+            emplace_back();
+    }
+
+    template <typename T, std::size_t CAPACITY>
+    void InplaceVector<T, CAPACITY>::clear()
+    {
+        std::destroy(begin(), end());
+
+        size_ = 0;
+    }
+
+    template <typename T, std::size_t CAPACITY>
+    Internals_::InplaceVectoredValue<T, CAPACITY>::InplaceVectoredValue(InplaceVector<T, CAPACITY>&& items, std::size_t min_items)
+    :   items_(std::move(items))
+    ,   min_items_(min_items)
+    {
+        // Check if the size of non-empty initial value complies argument quantifier lower boundary (the upper one is the capacity):
+        if (!items_.empty() && items_.size() < min_items_)
+            throw OptionAccessException::SpecifiedNumberOfItemsIsLessThanMinimum(items_.size(), min_items_, std::source_location::current());
+    }
+}
+
+#endif // SIMPLE_ARG_PARSER_INPLACE_VECTOR_HPP
@@ -0,0 +1,331 @@
+// Copyright 2025 arkanarian-a
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is furnished
+// to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef SIMPLE_ARG_PARSER_INSTRUMENTATION_HPP
+#define SIMPLE_ARG_PARSER_INSTRUMENTATION_HPP
+
+// This file contains the optional parse instrumentation of the library (per-option counters and Parser::parse phase timings).
+//
+// The instrumentation is compiled in only if the following macro is predefined:
+//
+// SIMPLE_ARG_PARSER_ENABLE_INSTRUMENTATION - to collect OptionStatistics and ParserStatistics while parsing.
+//
+// NOTE: the macro changes the layout of Option and Parser classes, so it MUST be defined identically for the library
+//       build and for any code using it.
+// When the macro is not defined, all the instrumentation hooks are empty inline functions of empty classes, so they
+// cost nothing, and statistics accessors return zeroed structures.
+
+#include <chrono>
+#include <vector>
+#include <ostream>
+#include <string_view>
+
+
+namespace SimpleArgParser
+{
+// ------------
+// Declarations
+// ------------
+    enum class ParsePhase: unsigned int
+    // Phases of Parser::parse measured by instrumentation
+    {
+        Lookup = 0          // Option key search
+    ,   Conversion = 1      // Option value tokens conversion (by inputters)
+    ,   QuantifierCheck = 2 // Vectored option value quantifier checks
+    };
+
+    struct OptionStatistics
+    // Counters collected for an option while parsing (accumulated through all Parser::parse calls).
+    {
+        std::size_t                 tokens_consumed{0};         // Value tokens consumed (option keys excluded)
+        std::size_t                 items_produced{0};          // Values (or vectored value items) produced
+        std::size_t                 storage_growth_bytes{0};    // Growth of the value storage capacity (in bytes, not allocations counted)
+        std::size_t                 exception_count{0};         // Exceptions thrown while parsing option value
+        std::chrono::nanoseconds    conversion_time{0};         // Total time spent for value conversion
+        std::chrono::nanoseconds    quantifier_check_time{0};   // Part of conversion_time spent for quantifier checks
+    };
+
+    struct ParserStatistics
+    // Timings of Parser::parse phases (accumulated through all Parser::parse calls).
+    {
+        std::size_t                 parse_count{0};             // Number of Parser::parse calls
+        std::chrono::nanoseconds    lookup_time{0};             // Total time of ParsePhase::Lookup
+        std::chrono::nanoseconds    conversion_time{0};         // Total time of ParsePhase::Conversion
+        std::chrono::nanoseconds    quantifier_check_time{0};   // Total time of ParsePhase::QuantifierCheck
+    };
+
+    std::string_view to_string_view(ParsePhase);
+
+    namespace Internals_
+    {
+#ifdef SIMPLE_ARG_PARSER_ENABLE_INSTRUMENTATION
+
+        inline constexpr bool INSTRUMENTATION_ENABLED{true};
+
+        class Stopwatch
+        // Measures time elapsed since its construction.
+        {
+        public:
+
+            using Clock = std::chrono::steady_clock;
+
+            Stopwatch(): start_(Clock::now()) {}
+
+            Clock::time_point started() const { return start_; }
+            std::chrono::nanoseconds elapsed() const { return Clock::now() - start_; }
+
+        private:
+
+            Clock::time_point start_;
+        };
+
+        class OptionInstrumentation
+        // Keeper of OptionStatistics for an Option object.
+        {
+        public:
+
+            void record_conversion(std::size_t tokens_consumed, const Stopwatch& stopwatch)
+            {
+                statistics_.tokens_consumed+=tokens_consumed;
+                statistics_.conversion_time+=stopwatch.elapsed();
+            }
+
+            void record_items(std::size_t items_produced, std::size_t storage_bytes_before, std::size_t storage_bytes_after)
+            {
+                statistics_.items_produced+=items_produced;
+
+                if (storage_bytes_after > storage_bytes_before)
+                    statistics_.storage_growth_bytes+=storage_bytes_after - storage_bytes_before;
+            }
+
+            void record_quantifier_check(const Stopwatch& stopwatch) { statistics_.quantifier_check_time+=stopwatch.elapsed(); }
+            void record_exception() { ++statistics_.exception_count; }
+
+            void reset() { statistics_ = {}; }
+
+            const OptionStatistics& statistics() const { return statistics_; }
+
+        private:
+
+            OptionStatistics statistics_;
+        };
+
+        class ParserInstrumentation
+        // Keeper of ParserStatistics and of trace events recorded by last Parser::parse (or Parser::merge).
+        {
+        public:
+
+            struct TraceEvent
+            {
+                std::string_view            name;       // Declared option key (not copied), empty if there is no option
+                ParsePhase                  phase;
+                Stopwatch::Clock::time_point start;
+                std::chrono::nanoseconds    duration;
+            };
+
+            struct ConversionMark
+            // Conversion start mark keeping the time and the option quantifier check time before the conversion.
+            {
+                Stopwatch                   stopwatch;
+                std::chrono::nanoseconds    quantifier_check_time;
+            };
+
+            struct Conversion
+            // Conversion measured by measure_conversion() (possibly on a worker thread) to be recorded later.
+            {
+                Stopwatch::Clock::time_point start;
+                std::chrono::nanoseconds    duration;
+                std::chrono::nanoseconds    quantifier_check_time;
+            };
+
+            void record_parse()
+            // The events of the previous parsing are dropped (their storage is reused), so they don't grow across parses.
+            {
+                ++statistics_.parse_count;
+                clear_trace_events();
+            }
+
+            void clear_trace_events() { trace_events_.clear(); }
+
+            void record_lookup(std::string_view option_key, const Stopwatch& stopwatch)
+            {
+                auto duration{stopwatch.elapsed()};
+
+                statistics_.lookup_time+=duration;
+                trace_events_.push_back({option_key, ParsePhase::Lookup, stopwatch.started(), duration});
+            }
+
+            ConversionMark start_conversion(const OptionInstrumentation& option_instrumentation) const
+            {
+                return {{}, option_instrumentation.statistics().quantifier_check_time};
+            }
+
+            Conversion measure_conversion(const OptionInstrumentation& option_instrumentation, const ConversionMark& mark) const
+            {
+                return {mark.stopwatch.started(), mark.stopwatch.elapsed(), option_instrumentation.statistics().quantifier_check_time - mark.quantifier_check_time};
+            }
+
+            void record_conversion(std::string_view option_key, const OptionInstrumentation& option_instrumentation, const ConversionMark& mark)
+            {
+                record_conversion(option_key, measure_conversion(option_instrumentation, mark));
+            }
+
+            void record_conversion(std::string_view option_key, const Conversion& conversion)
+            {
+                const auto& [start, duration, quantifier_check_time]{conversion};
+
+                statistics_.conversion_time+=duration - quantifier_check_time;
+                statistics_.quantifier_check_time+=quantifier_check_time;
+                trace_events_.push_back({option_key, ParsePhase::Conversion, start, duration});
+
+                if (quantifier_check_time.count())
+                    trace_events_.push_back
+                    (
+                        {option_key, ParsePhase::QuantifierCheck, start + duration - quantifier_check_time, quantifier_check_time}
+                    );
+            }
+
+            void reset() { statistics_ = {}; trace_events_.clear(); }
+
+            const ParserStatistics& statistics() const { return statistics_; }
+
+            std::ostream& output_trace_events(std::ostream& os) const
+            // Output recorded events as Chrome trace-event JSON (complete events, timestamps in microseconds)
+            {
+                auto output_json_string = [&os] (std::string_view s)
+                {
+                    os << '"';
+
+                    for (auto c : s)
+                    {
+                        if (c == '"' || c == '\\')
+                            os << '\\' << c;
+                        else if (static_cast<unsigned char>(c) < 0x20)
+                            os << ' ';
+                        else
+                            os << c;
+                    }
+
+                    os << '"';
+                };
+
+                auto origin{trace_events_.empty() ? Stopwatch::Clock::time_point{} : trace_events_.front().start};
+
+                os << "{\"traceEvents\":[";
+
+                for (std::size_t event_count{trace_events_.size()}; const auto& event : trace_events_)
+                {
+                    os << "{\"name\":";
+                    output_json_string(event.name);
+                    os
+                    <<  ",\"cat\":\"" << to_string_view(event.phase) << "\",\"ph\":\"X\",\"pid\":1,\"tid\":1"
+                    <<  ",\"ts\":" << std::chrono::duration<double, std::micro>(event.start - origin).count()
+                    <<  ",\"dur\":" << std::chrono::duration<double, std::micro>(event.duration).count()
+                    <<  "}" << (--event_count ? "," : "")
+                    ;
+                }
+
+                return os << "],\"displayTimeUnit\":\"ns\"}";
+            }
+
+        private:
+
+            ParserStatistics        statistics_;
+            std::vector<TraceEvent> trace_events_;
+        };
+
+#else
+
+        inline constexpr bool INSTRUMENTATION_ENABLED{false};
+
+        class Stopwatch
+        // Empty stub of instrumentation stopwatch.
+        {};
+
+        class OptionInstrumentation
+        // Empty stub of OptionStatistics keeper.
+        {
+        public:
+
+            void record_conversion(std::size_t, const Stopwatch&) {}
+            void record_items(std::size_t, std::size_t, std::size_t) {}
+            void record_quantifier_check(const Stopwatch&) {}
+            void record_exception() {}
+
+            void reset() {}
+
+            OptionStatistics statistics() const { return {}; }
+        };
+
+        class ParserInstrumentation
+        // Empty stub of ParserStatistics keeper.
+        {
+        public:
+
+            struct ConversionMark
+            {};
+
+            struct Conversion
+            {};
+
+            void record_parse() {}
+            void clear_trace_events() {}
+            void record_lookup(std::string_view, const Stopwatch&) {}
+            ConversionMark start_conversion(const OptionInstrumentation&) const { return {}; }
+            Conversion measure_conversion(const OptionInstrumentation&, const ConversionMark&) const { return {}; }
+            void record_conversion(std::string_view, const OptionInstrumentation&, const ConversionMark&) {}
+            void record_conversion(std::string_view, const Conversion&) {}
+
+            void reset() {}
+
+            ParserStatistics statistics() const { return {}; }
+
+            std::ostream& output_trace_events(std::ostream& os) const { return os << "{\"traceEvents\":[]}"; }
+        };
+
+#endif
+
+        template <typename T>
+        std::size_t storage_bytes(const T& value)
+        // Bytes of dynamic storage reserved by a value (for instrumentation purposes only, so it's zero if disabled).
+        {
+            if constexpr (INSTRUMENTATION_ENABLED && requires { value.capacity(); })
+                return value.capacity() * sizeof(typename T::value_type);
+            else
+                return 0;
+        }
+    }
+
+
+// -----------
+// Definitions
+// -----------
+    inline std::string_view to_string_view(ParsePhase phase)
+    {
+        switch (phase)
+        {
+            case ParsePhase::Lookup:            return "lookup";
+            case ParsePhase::Conversion:        return "conversion";
+            case ParsePhase::QuantifierCheck:   return "quantifier_check";
+        }
+
+        return "unknown";
+    }
+}
+
+#endif // SIMPLE_ARG_PARSER_INSTRUMENTATION_HPP
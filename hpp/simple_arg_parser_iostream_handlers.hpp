@@ -22,8 +22,16 @@
 #include <iostream>
 #include <functional>
 #include <any>
+#include <span>
+#include <typeinfo>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
 #include <optional>
+#include <charconv>
+#include <string_view>
 #include "simple_arg_parser_vectored_value.hpp"
+#include "simple_arg_parser_fingerprint.hpp"
 
 namespace SimpleArgParser
 {
@@ -43,10 +51,37 @@ namespace SimpleArgParser
         std::size_t representation_token_count;  // Number of tokens (words) in a stream to represent the option value
     };
 
+    namespace Internals_
+    {
+        template <typename T>
+        concept IsTokenConvertible =
+            std::is_arithmetic_v<T>
+        &&  !std::is_same_v<T, bool>
+        &&  !std::is_same_v<T, char>
+        &&  !std::is_same_v<T, signed char>
+        &&  !std::is_same_v<T, unsigned char>
+        &&  !std::is_same_v<T, wchar_t>
+        &&  !std::is_same_v<T, char8_t>
+        &&  !std::is_same_v<T, char16_t>
+        &&  !std::is_same_v<T, char32_t>;
+        // Types converted from a command line argument token directly with std::from_chars (without any stream).
+        // Character types are excluded, because the stream extracts them as characters, not as numbers.
+
+        template <IsTokenConvertible T>
+        std::optional<std::string> convert_token(std::string_view, T&);
+        // Convert whole token into arithmetic value with std::from_chars (the leading '+' sign is accepted as well).
+        // Returns std::nullopt on success or an error description (of std::string) otherwise. Never allocates on success.
+    }
+
     template <typename T>
     struct ValueTraits: public TypeIndependentValueTraits
     // Structure to define different type-specific traits for an option value.
     // It could be specialized for the type if needed.
+    // The specialization may also provide the method
+    //     std::optional<std::string> input_token(std::string_view token, T& value) const
+    // converting a value represented by single command line argument token. Parser uses it instead of input(...)
+    // (avoiding any stream construction) when no custom inputter is set for the option and the value is represented by
+    // one token. So, the specialization of default_value_inputter<T> for such T is bypassed when parsing command line.
     {
         ValueTraits(): TypeIndependentValueTraits()
         {}
@@ -66,6 +101,39 @@ namespace SimpleArgParser
 
             return std::nullopt;
         }
+
+        std::optional<std::string> input_token(std::string_view token, T& value) const
+        requires Internals_::IsTokenConvertible<T>
+        // Allocation-free conversion of arithmetic value from a command line argument token.
+        {
+            return Internals_::convert_token(token, value);
+        }
+    };
+
+    template <>
+    struct ValueTraits<std::string_view>: public TypeIndependentValueTraits
+    // The value of std::string_view option refers to the command line argument token itself (without any copying), so it's
+    // possible to input it from command line arguments only. Stream input is not supported, because the stream doesn't
+    // outlive the input.
+    {
+        std::optional<std::string> output(std::ostream& os, std::string_view value) const
+        {
+            os << value;
+
+            return std::nullopt;
+        }
+
+        std::optional<std::string> input(std::istream&, std::string_view&) const
+        {
+            return "std::string_view option value can be input from command line arguments only!";
+        }
+
+        std::optional<std::string> input_token(std::string_view token, std::string_view& value) const
+        {
+            value = token;
+
+            return std::nullopt;
+        }
     };
 
     template <typename T>
@@ -87,6 +155,10 @@ namespace SimpleArgParser
     // It's design and behaviour are symmetric to default_value_outputter. The only important point have to be mensioned:
     // value inputter set when the Option object initialized will be used during parsing the option's value further.
     // MUST return std::nullopt on success or an error description (of std::string) otherwise.
+    // CAUTION: the values of arithmetic types (and std::string_view) represented by single tokens are converted from
+    //          command line arguments by ValueTraits<T>::input_token(...) (with std::from_chars, allocation-free), so a
+    //          user specialization of this function for such T is BYPASSED by Parser::parse (it's still called by stream
+    //          input, like Parser::input). Pass a custom inputter to the Option constructor to convert them otherwise.
     {
         return value_traits.input(is, value);
     }
@@ -99,6 +171,31 @@ namespace SimpleArgParser
     using ValueInputter = std::function<std::optional<std::string>(std::istream&, T&, ValueTraits<T>&)>;
     // This type defines the option value inputter (and parser!). Any user defined inputter MUST be of this type.
 
+    template <typename T>
+    struct AsyncValueInputter
+    // Inputter of I/O bound option values (checking file paths, loading certificates or models, etc.) represented by single
+    // tokens. Parser::parse doesn't run its task in place, but launches the tasks of all the values parsed on a local
+    // thread pool and joins them before returning (see Parser::set_async_input_concurrency). Since it's a callable of
+    // ValueInputter<T> signature, it's passed to Option constructors in place of the value inputter (in braces):
+    //
+    //     { {"--cert"sv}, std::string{}, {}, { SAP::AsyncValueInputter<std::string>{load_certificate} } }
+    //
+    // The task MUST be thread-safe and MUST return std::nullopt on success or an error description otherwise (reported
+    // as OptionIOException::ValueInputterFailure). The value input from std::istream is input by the task synchronously.
+    {
+        std::function<std::optional<std::string>(std::string_view, T&)> task;
+
+        std::optional<std::string> operator()(std::istream& is, T& value, ValueTraits<T>&) const
+        {
+            std::string token;
+
+            if (!(is >> token))
+                return "Failed to read option value token from std::istream!";
+
+            return task(token, value);
+        }
+    };
+
     class Option;
 
     namespace Internals_
@@ -107,6 +204,22 @@ namespace SimpleArgParser
         T& get_value(Option*);
         // Helper function to inderect the access to option's value from IOptionIO implementation.
 
+        template <typename T>
+        struct IsSpan: std::false_type {};
+
+        template <typename T, std::size_t EXTENT>
+        struct IsSpan<std::span<T, EXTENT>>: std::true_type {};
+
+        template <typename T>
+        concept HasRelocatableImage =
+            std::is_trivially_copyable_v<T>
+        &&  !std::is_pointer_v<T>
+        &&  !std::is_member_pointer_v<T>
+        &&  !IsSpan<T>::value
+        &&  !std::is_same_v<T, std::string_view>;
+        // Trivially copyable types whose bytes mean the same in another process (the ones known to refer to the memory
+        // of the process are excluded, user types holding pointers MUST NOT be published either).
+
         struct IOptionIO
         // Interface incapsulating option (and its value) input and output details.
         // It's used by Option class methods to input (or parse) and output Option's object.
@@ -131,6 +244,59 @@ namespace SimpleArgParser
             void input_option_value(std::istream& is) { return input_option_value_(is);  };
             // Input option value (according to its type).
 
+            void output_value_items(std::ostream& os) const { return output_value_items_(os); }
+            // Output option value items, each one followed by '\0' (to make command line arguments of them).
+
+            void hash_value(FingerprintHasher& hasher) const { return hash_value_(hasher); }
+            // Feed the option value to the hasher (see simple_arg_parser_fingerprint.hpp).
+
+            struct ValueShape
+            // Shape of option value representation in command line arguments
+            {
+                std::size_t item_token_count{0};    // Number of tokens representing a value item (0 for switches)
+                std::size_t max_items{0};           // Maximal number of value items (1 for scalar values)
+                bool        is_vectored{false};     // The value is vectored one
+            };
+
+            ValueShape value_shape() const { return value_shape_(); }
+            // Get the shape of option value representation.
+
+            std::any copy_value() const { return copy_value_(); }
+            // Get a deep copy of the option value (a copy of the pointee for the options referring to external values).
+            void restore_value(const std::any& value) { restore_value_(value); }
+            // Assign the copy made by copy_value() back to the option value (to the pointee for external values).
+
+            enum class ValueImageKind: std::uint8_t
+            {
+                Unavailable = 0 // The value type has no binary image (it's neither relocatable trivially copyable nor a string)
+            ,   Switch          // Switch state (the image is empty, the state is kept in the image owner's record)
+            ,   Trivial         // Items of trivially copyable type laid out contiguously
+            ,   Strings         // String items: StringImage records followed by the characters
+            };
+
+            struct StringImage
+            // Record of a string item in the image of a string value
+            {
+                std::uint64_t offset;   // Offset of the characters from the image beginning
+                std::uint64_t size;
+            };
+
+            struct ValueImage
+            // Description of the binary image of an option value (see SharedConfiguration)
+            {
+                ValueImageKind          kind{ValueImageKind::Unavailable};
+                const std::type_info*   item_type{nullptr};
+                std::size_t             item_size{0};   // Size of trivially copyable items (0 for other kinds)
+                std::size_t             item_count{0};
+                std::size_t             size{0};        // Image size in bytes
+            };
+
+            static constexpr std::size_t VALUE_IMAGE_ALIGNMENT{alignof(std::max_align_t)};
+
+            ValueImage value_image(std::byte* image = nullptr) const { return value_image_(image); }
+            // Describe the binary image of the option value, and write it if the image pointer is not nullptr (aligned
+            // to VALUE_IMAGE_ALIGNMENT, and sized with the previous call). Vectored value items are laid out contiguously.
+
             void link_to(Option* option_ptr) { option_ptr_ = option_ptr; };
             // Link this input/output option handler to the option specified with a pointer
             // This method is needed for Option copy constructor (see the comment there).
@@ -147,10 +313,34 @@ namespace SimpleArgParser
             // By default it returns nullptr (which meens 'no traits object defined').
             // Must be overriden in derived class to provide correct traits object.
 
+            virtual ValueShape value_shape_() const { return {}; }
+            // Implementation of value shape getter method.
+            // By default it returns zeroed shape (of switch option value).
+
+            virtual std::any copy_value_() const { return {}; }
+            // Implementation of value copy getter method.
+            // By default it returns an empty copy (switch values are copied by Parser).
+
+            virtual void restore_value_(const std::any&) {}
+            // Implementation of value restoring method.
+            // By default it does nothing (switch states are restored by Parser).
+
+            virtual ValueImage value_image_(std::byte*) const { return {}; }
+            // Implementation of value image method.
+            // By default it returns the description of unavailable image.
+
             virtual void output_option_(std::ostream&) const = 0;
             // Implementation of method outputting the option (its key and value).
             // Must be overriden in derived class accordingly.
 
+            virtual void output_value_items_(std::ostream&) const {}
+            // Implementation of method outputting option's value items.
+            // By default it does nothing (switch options have no value items).
+
+            virtual void hash_value_(FingerprintHasher&) const {}
+            // Implementation of method hashing option's value.
+            // By default it does nothing (switch states are kept in the packed bits of the Parser, which hashes them itself).
+
             virtual void input_option_value_(std::istream&) {};
             // Implementation of method inputting option's value.
             // By default it does nothing.
@@ -165,35 +355,84 @@ namespace SimpleArgParser
 
         const std::string_view& get_key(Option*);
 
-        template <typename T, bool IS_VECTORED_VALUE>
+        template <typename T, bool IS_VECTORED_VALUE, typename VALUE_CONTAINER = std::vector<T>>
         class OptionIOImpl: public IOptionIO
-        // Implementation of IOptionIO option input/output handler
+        // Implementation of IOptionIO option input/output handler.
+        // VALUE_CONTAINER is the container of vectored value items (std::vector<T> or InplaceVector<T, CAPACITY>).
         {
         public:
 
             OptionIOImpl(ValueOutputter<T>&& = {}, ValueInputter<T>&& = {}, ValueTraits<T>&& = {});
+            // Empty outputter or inputter is substituted with default_value_outputter<T> or default_value_inputter<T>.
             ~OptionIOImpl() override = default;
 
+            // Typed (and so allocation-free) interface used by Option when parsing its value:
+
+            const ValueTraits<T>& value_traits() const { return value_traits_; }
+
+            bool accepts_token_input() const { return accepts_token_input_; }
+            // True if the value may be converted from a single command line argument token with input_token(...) method.
+
+            void input_token(std::string_view, T&);
+            // Convert the value from a single token with ValueTraits<T>::input_token(...). Throws ValueInputterFailure on failure.
+
+            void input_stream_value(std::istream& is, T& value) { input_value_(is, value); }
+            // Input the value with the inputter. Throws ValueInputterFailure on failure.
+
+            const AsyncValueInputter<T>* async_value_inputter() const { return value_inputter_.template target<AsyncValueInputter<T>>(); }
+            // Get the inputter if it's AsyncValueInputter<T> (nullptr otherwise).
+
+            void input_tokens(const char* const*, std::size_t, T*);
+            // Convert a sequence of single token values (vectored value items) in a row with input_token(...).
+            // Throws ValueInputterFailure on the first failure.
+
         private:
 
             std::any get_value_inputter_() const override;
             std::any get_value_traits_() const override;
+            ValueShape value_shape_() const override;
+            std::any copy_value_() const override;
+            void restore_value_(const std::any&) override;
+            ValueImage value_image_(std::byte*) const override;
 
             void input_value_(std::istream&, T&);
             void output_value_(std::ostream&, const T&) const;
 
             void output_option_(std::ostream&) const override;
+            void output_value_items_(std::ostream&) const override;
+            void hash_value_(FingerprintHasher&) const override;
+            void hash_item_(FingerprintHasher&, const T&) const;
             void input_option_value_(std::istream&) override;
 
             ValueTraits<T>      value_traits_;
             ValueOutputter<T>   value_outputter_;
             ValueInputter<T>    value_inputter_;
+            bool                accepts_token_input_;
         };
 
 
 // -----------
 // Definitions
 // -----------
+        template <IsTokenConvertible T>
+        std::optional<std::string> convert_token(std::string_view token, T& value)
+        {
+            auto first{token.data()}, last{token.data() + token.size()};
+
+            if (first != last && *first == '+' && last - first > 1 && *(first + 1) != '-')
+                ++first;
+
+            auto [ptr, ec] = std::from_chars(first, last, value);
+
+            if (ec == std::errc::result_out_of_range)
+                return std::format("Value '{}' is out of the range of the option value type!", token);
+
+            if (ec != std::errc{} || ptr != last)
+                return std::format("Failed to convert '{}' to the option value!", token);
+
+            return std::nullopt;
+        }
+
         template <typename T>
         std::optional<std::string> IOptionIO::input_value(std::istream& is, T& value)
         {
@@ -226,52 +465,157 @@ namespace SimpleArgParser
             }
         }
 
-        template <typename T, bool IS_VECTORED_VALUE>
-        OptionIOImpl<T, IS_VECTORED_VALUE>::OptionIOImpl
+        template <typename T, bool IS_VECTORED_VALUE, typename VALUE_CONTAINER>
+        OptionIOImpl<T, IS_VECTORED_VALUE, VALUE_CONTAINER>::OptionIOImpl
         (
             ValueOutputter<T>&& value_outputter
         ,   ValueInputter<T>&& value_inputter
         ,   ValueTraits<T>&& value_traits
         )
         :   value_traits_(value_traits)
-        ,   value_outputter_(value_outputter)
-        ,   value_inputter_(value_inputter)
-        {}
+        ,   value_outputter_(value_outputter ? value_outputter : default_value_outputter<T>)
+        ,   value_inputter_(value_inputter ? value_inputter : default_value_inputter<T>)
+        ,   accepts_token_input_(!value_inputter && value_traits_.representation_token_count == 1)
+        {
+            if constexpr (!requires (T& value) { value_traits_.input_token(std::string_view{}, value); })
+                accepts_token_input_ = false;
+        }
+
+        template <typename T, bool IS_VECTORED_VALUE, typename VALUE_CONTAINER>
+        void OptionIOImpl<T, IS_VECTORED_VALUE, VALUE_CONTAINER>::input_token(std::string_view token, T& value)
+        {
+            if constexpr (requires { value_traits_.input_token(token, value); })
+            {
+                if (auto failure_message{value_traits_.input_token(token, value)}; failure_message)
+                    throw OptionIOException::ValueInputterFailure(*failure_message, std::source_location::current());
+            }
+            else
+            {
+                throw InternalError::OptionIOTypeMismatch("Token input is not supported by value traits", std::source_location::current());
+            }
+        }
+
+        template <typename T, bool IS_VECTORED_VALUE, typename VALUE_CONTAINER>
+        void OptionIOImpl<T, IS_VECTORED_VALUE, VALUE_CONTAINER>::input_tokens(const char* const* tokens, std::size_t token_count, T* values)
+        {
+            for (auto tokens_end{tokens + token_count}; tokens != tokens_end; ++tokens, ++values)
+                input_token(*tokens, *values);
+        }
 
-        template <typename T, bool IS_VECTORED_VALUE>
-        std::any OptionIOImpl<T, IS_VECTORED_VALUE>::get_value_inputter_() const
+        template <typename T, bool IS_VECTORED_VALUE, typename VALUE_CONTAINER>
+        std::any OptionIOImpl<T, IS_VECTORED_VALUE, VALUE_CONTAINER>::get_value_inputter_() const
         {
             return value_inputter_;
         }
 
-        template <typename T, bool IS_VECTORED_VALUE>
-        std::any OptionIOImpl<T, IS_VECTORED_VALUE>::get_value_traits_() const
+        template <typename T, bool IS_VECTORED_VALUE, typename VALUE_CONTAINER>
+        std::any OptionIOImpl<T, IS_VECTORED_VALUE, VALUE_CONTAINER>::get_value_traits_() const
         {
             return value_traits_;
         }
 
-        template <typename T, bool IS_VECTORED_VALUE>
-        void OptionIOImpl<T, IS_VECTORED_VALUE>::input_value_(std::istream& is, T& value)
+        template <typename T, bool IS_VECTORED_VALUE, typename VALUE_CONTAINER>
+        IOptionIO::ValueShape OptionIOImpl<T, IS_VECTORED_VALUE, VALUE_CONTAINER>::value_shape_() const
+        {
+            if constexpr (IS_VECTORED_VALUE)
+                return {value_traits_.representation_token_count, Internals_::get_value<typename VectoredValueFor<VALUE_CONTAINER>::type>(option_ptr_).max_items(), true};
+            else
+                return {value_traits_.representation_token_count, 1, false};
+        }
+
+        template <typename T, bool IS_VECTORED_VALUE, typename VALUE_CONTAINER>
+        std::any OptionIOImpl<T, IS_VECTORED_VALUE, VALUE_CONTAINER>::copy_value_() const
+        {
+            if constexpr (IS_VECTORED_VALUE)
+                return VALUE_CONTAINER(Internals_::get_value<typename VectoredValueFor<VALUE_CONTAINER>::type>(option_ptr_).items());
+            else
+                return T(Internals_::get_value<T>(option_ptr_));
+        }
+
+        template <typename T, bool IS_VECTORED_VALUE, typename VALUE_CONTAINER>
+        void OptionIOImpl<T, IS_VECTORED_VALUE, VALUE_CONTAINER>::restore_value_(const std::any& value)
+        {
+            if constexpr (IS_VECTORED_VALUE)
+                Internals_::get_value<typename VectoredValueFor<VALUE_CONTAINER>::type>(option_ptr_).items() = std::any_cast<const VALUE_CONTAINER&>(value);
+            else
+                Internals_::get_value<T>(option_ptr_) = std::any_cast<const T&>(value);
+        }
+
+        template <typename T, bool IS_VECTORED_VALUE, typename VALUE_CONTAINER>
+        IOptionIO::ValueImage OptionIOImpl<T, IS_VECTORED_VALUE, VALUE_CONTAINER>::value_image_(std::byte* image) const
+        {
+            auto make_image = [image] (const auto& items) -> ValueImage
+            {
+                std::size_t item_count{std::ranges::size(items)};
+
+                // The strings are tested first, since std::string_view is trivially copyable (but refers to the characters):
+                if constexpr (std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>)
+                {
+                    std::size_t size{item_count * sizeof(StringImage)}, item_index{0};
+
+                    for (const T& item : items)
+                    {
+                        if (image)
+                        {
+                            StringImage string_image{size, item.size()};
+
+                            std::memcpy(image + item_index * sizeof(StringImage), &string_image, sizeof(StringImage));
+                            std::memcpy(image + size, item.data(), item.size());
+                        }
+
+                        size+=item.size();
+                        ++item_index;
+                    }
+
+                    return {ValueImageKind::Strings, &typeid(T), 0, item_count, size};
+                }
+                else if constexpr (HasRelocatableImage<T> && alignof(T) <= VALUE_IMAGE_ALIGNMENT)
+                {
+                    if (image)
+                    {
+                        for (std::byte* item_image{image}; const T& item : items)
+                        {
+                            std::memcpy(item_image, &item, sizeof(T));
+                            item_image+=sizeof(T);
+                        }
+                    }
+
+                    return {ValueImageKind::Trivial, &typeid(T), sizeof(T), item_count, item_count * sizeof(T)};
+                }
+                else
+                {
+                    return {};
+                }
+            };
+
+            if constexpr (IS_VECTORED_VALUE)
+                return make_image(Internals_::get_value<VALUE_CONTAINER>(option_ptr_));
+            else
+                return make_image(std::span<const T, 1>{&Internals_::get_value<T>(option_ptr_), 1});
+        }
+
+        template <typename T, bool IS_VECTORED_VALUE, typename VALUE_CONTAINER>
+        void OptionIOImpl<T, IS_VECTORED_VALUE, VALUE_CONTAINER>::input_value_(std::istream& is, T& value)
         {
             if (auto failure_message{value_inputter_(is, value, value_traits_)}; failure_message)
                 throw OptionIOException::ValueInputterFailure(*failure_message, std::source_location::current());
         }
 
-        template <typename T, bool IS_VECTORED_VALUE>
-        void OptionIOImpl<T, IS_VECTORED_VALUE>::output_value_(std::ostream& os, const T& value) const
+        template <typename T, bool IS_VECTORED_VALUE, typename VALUE_CONTAINER>
+        void OptionIOImpl<T, IS_VECTORED_VALUE, VALUE_CONTAINER>::output_value_(std::ostream& os, const T& value) const
         {
             if (auto failure_message{value_outputter_(os, value, value_traits_)}; failure_message)
                 throw OptionIOException::ValueOututterFailure(*failure_message, std::source_location::current());
         }
 
-        template <typename T, bool IS_VECTORED_VALUE>
-        void OptionIOImpl<T, IS_VECTORED_VALUE>::output_option_(std::ostream& os) const
+        template <typename T, bool IS_VECTORED_VALUE, typename VALUE_CONTAINER>
+        void OptionIOImpl<T, IS_VECTORED_VALUE, VALUE_CONTAINER>::output_option_(std::ostream& os) const
         {
             os << get_key(option_ptr_);
 
             if constexpr (IS_VECTORED_VALUE)
             {
-                for (auto items = Internals_::get_value<std::vector<T>>(option_ptr_); const auto& item : items)
+                for (const auto& item : Internals_::get_value<VALUE_CONTAINER>(option_ptr_))
                     output_value_(os << " ", item);
             }
             else
@@ -280,12 +624,70 @@ namespace SimpleArgParser
             }
         }
 
-        template <typename T, bool IS_VECTORED_VALUE>
-        void OptionIOImpl<T, IS_VECTORED_VALUE>::input_option_value_(std::istream& is)
+        template <typename T, bool IS_VECTORED_VALUE, typename VALUE_CONTAINER>
+        void OptionIOImpl<T, IS_VECTORED_VALUE, VALUE_CONTAINER>::output_value_items_(std::ostream& os) const
+        {
+            if constexpr (IS_VECTORED_VALUE)
+            {
+                for (const auto& item : Internals_::get_value<VALUE_CONTAINER>(option_ptr_))
+                {
+                    output_value_(os, item);
+                    os << '\0';
+                }
+            }
+            else
+            {
+                output_value_(os, Internals_::get_value<T>(option_ptr_));
+                os << '\0';
+            }
+        }
+
+        template <typename T, bool IS_VECTORED_VALUE, typename VALUE_CONTAINER>
+        void OptionIOImpl<T, IS_VECTORED_VALUE, VALUE_CONTAINER>::hash_value_(FingerprintHasher& hasher) const
+        {
+            if constexpr (IS_VECTORED_VALUE)
+            {
+                const auto& items{Internals_::get_value<VALUE_CONTAINER>(option_ptr_)};
+
+                hasher.update_integer(static_cast<std::uint64_t>(items.size()));
+
+                for (const auto& item : items)
+                    hash_item_(hasher, item);
+            }
+            else
+            {
+                hash_item_(hasher, Internals_::get_value<T>(option_ptr_));
+            }
+        }
+
+        template <typename T, bool IS_VECTORED_VALUE, typename VALUE_CONTAINER>
+        void OptionIOImpl<T, IS_VECTORED_VALUE, VALUE_CONTAINER>::hash_item_(FingerprintHasher& hasher, const T& item) const
+        {
+            if constexpr (requires { value_traits_.hash(hasher, item); })
+            {
+                value_traits_.hash(hasher, item);
+            }
+            else if constexpr (IsBinaryHashable<T>)
+            {
+                hash_binary_value(hasher, item);
+            }
+            else
+            {
+                // The value is hashed by its text (followed by the text size, so the values of adjacent items don't mix):
+                FingerprintStreamBuffer buffer{hasher};
+                std::ostream os{&buffer};
+
+                output_value_(os, item);
+                hasher.update_integer(buffer.character_count());
+            }
+        }
+
+        template <typename T, bool IS_VECTORED_VALUE, typename VALUE_CONTAINER>
+        void OptionIOImpl<T, IS_VECTORED_VALUE, VALUE_CONTAINER>::input_option_value_(std::istream& is)
         {
             if constexpr (IS_VECTORED_VALUE)
             {
-                auto& value{Internals_::get_value<Internals_::VectoredValue<T>>(option_ptr_)};
+                auto& value{Internals_::get_value<typename Internals_::VectoredValueFor<VALUE_CONTAINER>::type>(option_ptr_)};
                 auto& items{value.items()};
                 auto representation_token_count{(get_value_traits<T>()).representation_token_count};
 
@@ -294,12 +696,12 @@ namespace SimpleArgParser
                 for
                 (
                     std::size_t items_got{0}, max_items_to_get{value.max_items() * representation_token_count}
-                ;   items_got <= max_items_to_get && is
+                ;   items_got < max_items_to_get && is && !(is >> std::ws).eof() // <-- no empty item is added at the end of stream
                 ;   items_got+=representation_token_count
                 )
                 {
                     items.resize(items_got / representation_token_count + 1);
-                    input_value_(is, items.at(items_got));
+                    input_value_(is, items.at(items_got / representation_token_count));
                 }
             }
             else
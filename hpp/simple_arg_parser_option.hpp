@@ -22,6 +22,7 @@
 #include <sstream>
 #include <iterator>
 #include <initializer_list>
+#include <functional>
 #include <memory>
 
 #include <assert.h>
@@ -29,6 +30,9 @@
 #include "simple_arg_parser_switch_state.hpp"
 #include "simple_arg_parser_scalar_value.hpp"
 #include "simple_arg_parser_vectored_value.hpp"
+#include "simple_arg_parser_inplace_vector.hpp"
+#include "simple_arg_parser_enum_value_traits.hpp"
+#include "simple_arg_parser_instrumentation.hpp"
 
 
 namespace SimpleArgParser
@@ -41,6 +45,7 @@ namespace SimpleArgParser
         std::string_view                key{};
         std::optional<std::string_view> alias_key{};
         std::optional<std::string_view> description{};
+        std::optional<std::string_view> environment_variable{};     // Name of the environment variable bound to the option
     };
 
     class Parser;
@@ -85,6 +90,19 @@ namespace SimpleArgParser
         ,   ValueOutputter<T>&& = nullptr
         );
 
+        template <typename T, std::size_t MIN_ITEMS, std::size_t MAX_ITEMS>
+        Option
+        // This constructor is for a vectored option value with compile-time bounded item count. The items are kept inside
+        // the InplaceVector<T, MAX_ITEMS> (so, they are parsed with no heap allocations at all).
+        (
+            OptionAttributes&&
+        ,   InplaceVector<T, MAX_ITEMS>&&
+        ,   StaticQuantifier<MIN_ITEMS, MAX_ITEMS>
+        ,   ValueTraits<T>&& = {}
+        ,   ValueInputter<T>&& = nullptr
+        ,   ValueOutputter<T>&& = nullptr
+        );
+
         template <typename T>
         Option
         // This constructor is for a scalar (containing only one value instead of a sequence of values) valued option
@@ -130,6 +148,10 @@ namespace SimpleArgParser
 
         bool has_value() const;
 
+        bool is_specified() const;
+        // Check whether the option has been specified by last parsing (in contrast to has_value(), which is true for
+        // defaulted value as well).
+
         template <typename T>
         const T& get_value() const;
 
@@ -139,17 +161,45 @@ namespace SimpleArgParser
         std::ostream& output(std::ostream&) const;
         std::istream& input(std::istream&);
 
+        OptionStatistics statistics() const;
+        // Counters collected while parsing the option (zeroed if SIMPLE_ARG_PARSER_ENABLE_INSTRUMENTATION is not defined).
+
     private:
 
         friend class Parser;
+        friend class SharedConfiguration;
 
         using SubrangeOfArgV_ = std::ranges::subrange<const char**, const char**>;
         // Subrange for iterating the sequence of arguments passed.
 
-        void link_to_(Parser*);
-        // Make a link to the Parser which is this option defined for.
+        void link_to_(Parser*, std::size_t);
+        // Make a link to the Parser which is this option defined for and set its ordinal (position) in the Parser.
         bool option_key_is_defined_(std::string_view) const;
         // Check whether the option with specifid key is defined in the Parser (which is linked to this option).
+        bool is_switch_() const;
+        // Check whether the option is a switch (having SwitchState value set on by its key only).
+        bool switch_is_on_() const;
+        // Check whether the switch is on by its SwitchState value (used to seed the packed switch states of the Parser).
+        bool is_bound_switch_() const;
+        // Check whether the option is a switch bound to an external SwitchState variable (set by the application as well).
+        std::size_t count_value_tokens_(const SubrangeOfArgV_&, std::size_t) const;
+        // Count the leading tokens of the subrange, which belong to the option value (up to the maximal count specified).
+        std::size_t count_value_span_(const SubrangeOfArgV_&) const;
+        // Count the leading tokens of the subrange, which the option value parser consumes (without their conversion).
+
+        std::size_t conversion_chunk_size_() const;
+        // Get the item count of vectored value chunks converted in parallel (0 if parallel conversion is disabled in the Parser).
+        void run_conversion_chunks_(std::size_t, const std::function<void(std::size_t)>&);
+        // Convert the chunks of vectored value (by chunk indices) with the Parser's thread pool. Rethrows the exception
+        // of the first failed chunk (so the first failed item is reported as it would be by serial conversion).
+
+        template <typename T>
+        void defer_async_input_(const AsyncValueInputter<T>&, std::string_view, T&);
+        // Defer the input of the value (or value item) from the token with AsyncValueInputter<T> until the Parser joins
+        // the deferred inputs. The token and the value MUST outlive the parse.
+        void defer_input_(std::function<std::optional<std::string>()>&&);
+        void discard_deferred_inputs_();
+        // Discard the inputs deferred for this option (when its value is parsed once again).
 
         template <typename T>
         T& get_value_();
@@ -175,6 +225,10 @@ namespace SimpleArgParser
         ArgParser_                              arg_parser_;
         std::shared_ptr<Internals_::IOptionIO>  io_handler_;
         Parser*                                 parser_ptr_{nullptr};
+        std::size_t                             ordinal_{0};
+        std::size_t                             argument_position_{0};  // Position of the option key in argv being parsed
+
+        [[no_unique_address]] Internals_::OptionInstrumentation instrumentation_;
     };
 
 
@@ -198,8 +252,8 @@ namespace SimpleArgParser
         (
             std::make_shared<Internals_::OptionIOImpl<T, true>>
             (
-                std::move(value_outputter ? value_outputter : default_value_outputter<T>)
-            ,   std::move(value_inputter ? value_inputter : default_value_inputter<T>)
+                std::move(value_outputter)
+            ,   std::move(value_inputter)
             ,   std::move(value_traits)
             )
         )
@@ -222,8 +276,32 @@ namespace SimpleArgParser
         (
             std::make_shared<Internals_::OptionIOImpl<T, true>>
             (
-                std::move(value_outputter ? value_outputter : default_value_outputter<T>)
-            ,   std::move(value_inputter ? value_inputter : default_value_inputter<T>)
+                std::move(value_outputter)
+            ,   std::move(value_inputter)
+            ,   std::move(value_traits)
+            )
+        )
+    {}
+
+    template <typename T, std::size_t MIN_ITEMS, std::size_t MAX_ITEMS>
+    Option::Option
+    (
+        OptionAttributes&& attributes
+    ,   InplaceVector<T, MAX_ITEMS>&& value
+    ,   StaticQuantifier<MIN_ITEMS, MAX_ITEMS>
+    ,   ValueTraits<T>&& value_traits
+    ,   ValueInputter<T>&& value_inputter
+    ,   ValueOutputter<T>&& value_outputter
+    )
+    :   attributes_(attributes)
+    ,   value_(Internals_::InplaceVectoredValue<T, MAX_ITEMS>(std::move(value), MIN_ITEMS))
+    ,   arg_parser_(&Option::parse_argument_<InplaceVector<T, MAX_ITEMS>>)
+    ,   io_handler_
+        (
+            std::make_shared<Internals_::OptionIOImpl<T, true, InplaceVector<T, MAX_ITEMS>>>
+            (
+                std::move(value_outputter)
+            ,   std::move(value_inputter)
             ,   std::move(value_traits)
             )
         )
@@ -245,8 +323,8 @@ namespace SimpleArgParser
         (
             std::make_shared<Internals_::OptionIOImpl<T, false>>
             (
-                (value_outputter ? value_outputter : default_value_outputter<T>)
-            ,   (value_inputter ? value_inputter : default_value_inputter<T>)
+                std::move(value_outputter)
+            ,   std::move(value_inputter)
             ,   std::move(value_traits)
             )
         )
@@ -269,8 +347,8 @@ namespace SimpleArgParser
         (
             std::make_shared<Internals_::OptionIOImpl<T, true>>
             (
-                std::move(value_outputter ? value_outputter : default_value_outputter<T>)
-            ,   std::move(value_inputter ? value_inputter : default_value_inputter<T>)
+                std::move(value_outputter)
+            ,   std::move(value_inputter)
             ,   std::move(value_traits)
             )
         )
@@ -292,8 +370,8 @@ namespace SimpleArgParser
         (
             std::make_shared<Internals_::OptionIOImpl<T, false>>
             (
-                std::move(value_outputter ? value_outputter : default_value_outputter<T>)
-            ,   std::move(value_inputter ? value_inputter : default_value_inputter<T>)
+                std::move(value_outputter)
+            ,   std::move(value_inputter)
             ,   std::move(value_traits)
             )
         )
@@ -317,7 +395,7 @@ namespace SimpleArgParser
         try
         {
             if constexpr (Internals_::IsVector<T>())
-                return std::any_cast<Internals_::VectoredValue<typename T::value_type>&>(value_);
+                return std::any_cast<typename Internals_::VectoredValueFor<T>::type&>(value_);
             else
                 return std::any_cast<Internals_::ScalarValue<T>&>(value_).get_value();
         }
@@ -331,37 +409,94 @@ namespace SimpleArgParser
     int Option::parse_argument_(SubrangeOfArgV_& subrange_of_argv)
     // Type-dependent option value parser implementation.
     // Implements one of two different algorithms, depending on wether the option has vectored or scalar value.
+    // A value represented by single token is converted with ValueTraits<T>::input_token(...) directly from the argument
+    // (if possible, see ValueTraits<T> comments), otherwise the tokens are passed to the inputter through a stream.
     {
         if constexpr (Internals_::IsVector<T>())
         {
             using ItemType = typename T::value_type;
+            using StoredValue = typename Internals_::VectoredValueFor<T>::type;
+            using ValueContainer = std::remove_cvref_t<decltype(std::declval<StoredValue&>().items())>;
 
-            auto& value = get_value_<Internals_::VectoredValue<ItemType>>();
+            auto& io_handler{static_cast<Internals_::OptionIOImpl<ItemType, true, ValueContainer>&>(*io_handler_)};
+            auto& value = get_value_<StoredValue>();
             auto& items = value.items();
-            auto representation_token_count{(io_handler_->get_value_traits<ItemType>()).representation_token_count};
+            auto representation_token_count{io_handler.value_traits().representation_token_count};
             std::size_t args_consumed{0}, max_args_to_consume{value.max_items() * representation_token_count};
+            std::size_t storage_bytes_before{Internals_::storage_bytes(items)};
 
             items.clear();
 
-            // Iterate the subrange until any next option key met or the args parsed count reaches the max values of the quantifier:
-            for
-            (
-                auto arg{subrange_of_argv.begin()}, arg_items_num{representation_token_count}
-            ;   arg != subrange_of_argv.end() && !option_key_is_defined_(*arg) && args_consumed < max_args_to_consume
-            ;   arg+=arg_items_num, args_consumed+=arg_items_num
-            )
+            if (auto* async_inputter{io_handler.async_value_inputter()}; async_inputter && representation_token_count == 1)
             {
-                std::stringstream ss;
-                arg_items_num = std::min(representation_token_count, static_cast<std::size_t>(subrange_of_argv.end() - arg));
+                discard_deferred_inputs_();
+
+                // The items are sized at once, so the deferred inputs may refer to them:
+                args_consumed = count_value_tokens_(subrange_of_argv, max_args_to_consume);
 
-                std::copy_n(arg, arg_items_num, std::ostream_iterator<std::string>(ss, " "));
+                items.resize(args_consumed);
 
-                items.resize(args_consumed / representation_token_count + 1);
-                io_handler_->input_value(ss, items.at(args_consumed / representation_token_count));
+                for (std::size_t item_index{0}; item_index < args_consumed; ++item_index)
+                    defer_async_input_(*async_inputter, *(subrange_of_argv.begin() + item_index), items[item_index]);
+            }
+            else if (io_handler.accepts_token_input())
+            {
+                // Count the value tokens first, then resize the items once and convert all the tokens in a row:
+                args_consumed = count_value_tokens_(subrange_of_argv, max_args_to_consume);
+
+                items.resize(args_consumed);
+
+                if (auto chunk_size{conversion_chunk_size_()}; chunk_size && args_consumed > chunk_size)
+                {
+                    // The items are converted in place, so the chunks converted in parallel keep their order:
+                    run_conversion_chunks_
+                    (
+                        (args_consumed + chunk_size - 1) / chunk_size
+                    ,   [&] (std::size_t chunk_index)
+                        {
+                            auto first_item{chunk_index * chunk_size};
+
+                            io_handler.input_tokens(subrange_of_argv.begin() + first_item, std::min(chunk_size, args_consumed - first_item), items.data() + first_item);
+                        }
+                    );
+                }
+                else
+                {
+                    io_handler.input_tokens(subrange_of_argv.begin(), args_consumed, items.data());
+                }
             }
+            else
+            {
+                // Iterate the subrange until any next option key met or the args parsed count reaches the max values of the quantifier:
+                for
+                (
+                    auto arg{subrange_of_argv.begin()}, arg_items_num{representation_token_count}
+                ;   arg != subrange_of_argv.end() && !option_key_is_defined_(*arg) && args_consumed < max_args_to_consume
+                ;   arg+=arg_items_num, args_consumed+=arg_items_num
+                )
+                {
+                    arg_items_num = std::min(representation_token_count, static_cast<std::size_t>(subrange_of_argv.end() - arg));
+
+                    items.resize(args_consumed / representation_token_count + 1);
+
+                    std::stringstream ss;
+
+                    std::copy_n(arg, arg_items_num, std::ostream_iterator<std::string>(ss, " "));
+
+                    io_handler.input_stream_value(ss, items[args_consumed / representation_token_count]);
+                }
+            }
+
+            instrumentation_.record_items(items.size(), storage_bytes_before, Internals_::storage_bytes(items));
+
+            {
+                Internals_::Stopwatch stopwatch;
+
+                if (args_consumed < value.min_items())
+                    throw OptionAccessException::InsufficientNumberOfValueItems(get_key(), args_consumed, value.min_items(), std::source_location::current());
 
-            if (args_consumed < value.min_items())
-                throw OptionAccessException::InsufficientNumberOfValueItems(get_key(), args_consumed, value.min_items(), std::source_location::current());
+                instrumentation_.record_quantifier_check(stopwatch);
+            }
 
             subrange_of_argv.advance(args_consumed);
 
@@ -372,12 +507,30 @@ namespace SimpleArgParser
             if (subrange_of_argv.empty())
                 throw OptionParsingException::ScalarOptionValueLost{get_key(), std::source_location::current()};
 
-            std::stringstream ss;
-            auto arg_items_num{std::min((io_handler_->get_value_traits<T>()).representation_token_count, subrange_of_argv.size())};
+            auto& io_handler{static_cast<Internals_::OptionIOImpl<T, false>&>(*io_handler_)};
+            auto arg_items_num{std::min(io_handler.value_traits().representation_token_count, subrange_of_argv.size())};
+            auto& value{get_value_<T>()};
+            std::size_t storage_bytes_before{Internals_::storage_bytes(value)};
 
-            std::copy_n(subrange_of_argv.begin(), arg_items_num, std::ostream_iterator<std::string>(ss, " "));
+            if (auto* async_inputter{io_handler.async_value_inputter()}; async_inputter && arg_items_num == 1)
+            {
+                discard_deferred_inputs_();
+                defer_async_input_(*async_inputter, *subrange_of_argv.begin(), value);
+            }
+            else if (io_handler.accepts_token_input())
+            {
+                io_handler.input_token(*subrange_of_argv.begin(), value);
+            }
+            else
+            {
+                std::stringstream ss;
 
-            io_handler_->input_value(ss, get_value_<T>());
+                std::copy_n(subrange_of_argv.begin(), arg_items_num, std::ostream_iterator<std::string>(ss, " "));
+
+                io_handler.input_stream_value(ss, value);
+            }
+
+            instrumentation_.record_items(1, storage_bytes_before, Internals_::storage_bytes(value));
 
             subrange_of_argv.advance(arg_items_num);
 
@@ -386,6 +539,12 @@ namespace SimpleArgParser
     }
 
 
+    template <typename T>
+    void Option::defer_async_input_(const AsyncValueInputter<T>& async_inputter, std::string_view token, T& value)
+    {
+        defer_input_([&async_inputter, token, &value] { return async_inputter.task(token, value); });
+    }
+
     std::ostream& operator<<(std::ostream&, const Option&);
     std::istream& operator>>(std::istream&, Option&);
 
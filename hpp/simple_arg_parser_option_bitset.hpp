@@ -0,0 +1,135 @@
+// Copyright 2025 arkanarian-a
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is furnished
+// to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef SIMPLE_ARG_PARSER_OPTION_BITSET_HPP
+#define SIMPLE_ARG_PARSER_OPTION_BITSET_HPP
+
+#include <vector>
+#include <bit>
+#include <cstdint>
+#include <cstddef>
+
+
+namespace SimpleArgParser::Internals_
+{
+    class OptionBitSet
+    // Dense set of options indexed by option ordinal (its position in the Parser).
+    // All the set operations are performed word-wide (64 options per operation).
+    {
+    public:
+
+        using Word = std::uint64_t;
+
+        static constexpr std::size_t WORD_BITS{64};
+        static constexpr std::size_t NPOS{static_cast<std::size_t>(-1)};
+
+        OptionBitSet() = default;
+
+        explicit OptionBitSet(std::size_t size)
+        :   words_((size + WORD_BITS - 1) / WORD_BITS)
+        ,   size_(size)
+        {}
+
+        std::size_t size() const { return size_; }
+
+        void set(std::size_t ordinal)           { words_[ordinal / WORD_BITS] |= bit_(ordinal); }
+        void reset(std::size_t ordinal)         { words_[ordinal / WORD_BITS] &= ~bit_(ordinal); }
+        bool test(std::size_t ordinal) const    { return (words_[ordinal / WORD_BITS] & bit_(ordinal)) != 0; }
+
+        void clear()
+        {
+            for (auto& word : words_)
+                word = 0;
+        }
+
+        OptionBitSet& operator|=(const OptionBitSet& other)
+        {
+            for (std::size_t word_index{0}; word_index < words_.size(); ++word_index)
+                words_[word_index] |= other.words_[word_index];
+
+            return *this;
+        }
+
+        std::size_t count() const
+        {
+            std::size_t bit_count{0};
+
+            for (auto word : words_)
+                bit_count+=std::popcount(word);
+
+            return bit_count;
+        }
+
+        bool none() const
+        {
+            for (auto word : words_)
+                if (word) return false;
+
+            return true;
+        }
+
+        std::size_t intersection_count(const OptionBitSet& other) const
+        // Number of options contained in both sets.
+        {
+            std::size_t bit_count{0};
+
+            for (std::size_t word_index{0}; word_index < words_.size(); ++word_index)
+                bit_count+=std::popcount(words_[word_index] & other.words_[word_index]);
+
+            return bit_count;
+        }
+
+        std::size_t find_first_missing_in(const OptionBitSet& other) const
+        // Find the first option of this set which is not contained in the other one (or NPOS if there is no such option).
+        {
+            for (std::size_t word_index{0}; word_index < words_.size(); ++word_index)
+            {
+                if (auto missing{words_[word_index] & ~other.words_[word_index]}; missing)
+                    return word_index * WORD_BITS + std::countr_zero(missing);
+            }
+
+            return NPOS;
+        }
+
+        std::size_t find_next_common_with(const OptionBitSet& other, std::size_t from = 0) const
+        // Find the first option starting from ordinal specified, which is contained in both sets (or NPOS if there is no one).
+        {
+            for (std::size_t word_index{from / WORD_BITS}; word_index < words_.size(); ++word_index)
+            {
+                auto common{words_[word_index] & other.words_[word_index]};
+
+                if (word_index == from / WORD_BITS)
+                    common &= ~Word{0} << (from % WORD_BITS);
+
+                if (common)
+                    return word_index * WORD_BITS + std::countr_zero(common);
+            }
+
+            return NPOS;
+        }
+
+    private:
+
+        static Word bit_(std::size_t ordinal) { return Word{1} << (ordinal % WORD_BITS); }
+
+        std::vector<Word>   words_;
+        std::size_t         size_{0};
+    };
+}
+
+#endif // SIMPLE_ARG_PARSER_OPTION_BITSET_HPP
@@ -0,0 +1,154 @@
+// Copyright 2025 arkanarian-a
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is furnished
+// to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef SIMPLE_ARG_PARSER_RCU_HPP
+#define SIMPLE_ARG_PARSER_RCU_HPP
+
+// This file contains RcuCell<T>, the read-copy-update publication of immutable objects used for option value snapshots.
+//
+// Readers acquire the published object wait-free: a reader increments its counter of the current epoch parity and loads
+// the object pointer (no loops, no locks). The publisher swaps the pointer atomically, then flips the epoch twice waiting
+// for the counters of the parity left to drain each time (the two-phase grace period of userspace RCU), so no reader may
+// hold the previous object when it's deleted. The counters are spread over cache line sized slots picked by reader threads
+// round-robin, so the readers of different slots don't contend for the same cache line.
+
+#include <array>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <cstddef>
+
+
+namespace SimpleArgParser::Internals_
+{
+// ------------
+// Declarations
+// ------------
+    template <typename T>
+    class RcuCell
+    // Cell publishing immutable objects of type T to concurrent readers. Publishers are serialized with a mutex.
+    {
+    public:
+
+        class ReadGuard
+        // Read access to the object published (keeps it alive until the guard is destroyed).
+        {
+        public:
+
+            ReadGuard() = default;
+            ReadGuard(const ReadGuard&) = delete;
+            ReadGuard(ReadGuard&& other) noexcept : object_ptr_(other.object_ptr_), counter_ptr_(other.counter_ptr_) { other.counter_ptr_ = nullptr; }
+
+            ReadGuard& operator=(const ReadGuard&) = delete;
+            ReadGuard& operator=(ReadGuard&&) = delete;
+
+            ~ReadGuard() { if (counter_ptr_) counter_ptr_->fetch_sub(1, std::memory_order_release); }
+
+            const T* get() const        { return object_ptr_; }
+            const T& operator*() const  { return *object_ptr_; }
+            const T* operator->() const { return object_ptr_; }
+
+            explicit operator bool() const { return object_ptr_ != nullptr; }
+            // False if nothing is published yet.
+
+        private:
+
+            friend class RcuCell;
+
+            ReadGuard(const T* object_ptr, std::atomic<std::size_t>* counter_ptr) : object_ptr_(object_ptr), counter_ptr_(counter_ptr) {}
+
+            const T*                    object_ptr_{nullptr};
+            std::atomic<std::size_t>*   counter_ptr_{nullptr};
+        };
+
+        RcuCell() = default;
+        RcuCell(const RcuCell&) = delete;
+        RcuCell& operator=(const RcuCell&) = delete;
+
+        ~RcuCell() { delete current_.load(); }
+        // The readers MUST be gone before the cell is destroyed.
+
+        ReadGuard acquire() const;
+        // Acquire the object published last (wait-free).
+
+        void publish(std::unique_ptr<const T>);
+        // Publish the object and delete the previous one after its readers release it (blocks until then).
+
+    private:
+
+        static constexpr std::size_t READER_SLOT_COUNT{16};
+
+        struct alignas(64) ReaderSlot_
+        {
+            std::atomic<std::size_t> counters[2]{}; // Readers active by epoch parities
+        };
+
+        static std::size_t reader_slot_index_();
+        // Get the slot index of the calling thread (assigned round-robin on the first call).
+
+        mutable std::array<ReaderSlot_, READER_SLOT_COUNT>  reader_slots_;
+        std::atomic<const T*>                               current_{nullptr};
+        std::atomic<std::size_t>                            epoch_{0};
+        std::mutex                                          publish_mutex_;
+    };
+
+
+// -----------
+// Definitions
+// -----------
+    template <typename T>
+    typename RcuCell<T>::ReadGuard RcuCell<T>::acquire() const
+    {
+        auto& counter{reader_slots_[reader_slot_index_()].counters[epoch_.load() & 1]};
+
+        // NOTE: the counter MUST be incremented before the pointer is loaded (both are sequentially consistent), so the
+        // publisher which swaps the pointer after this load waits for this reader.
+        counter.fetch_add(1);
+
+        return {current_.load(), &counter};
+    }
+
+    template <typename T>
+    void RcuCell<T>::publish(std::unique_ptr<const T> object)
+    {
+        std::lock_guard lock{publish_mutex_};
+
+        std::unique_ptr<const T> previous{current_.exchange(object.release())};
+
+        // A reader holding the previous object has incremented a counter of either parity before the swap:
+        for (int phase{0}; phase < 2; ++phase)
+        {
+            auto parity{epoch_.fetch_add(1) & 1};
+
+            for (auto& reader_slot : reader_slots_)
+                while (reader_slot.counters[parity].load(std::memory_order_acquire) != 0) std::this_thread::yield();
+        }
+    }
+
+    template <typename T>
+    std::size_t RcuCell<T>::reader_slot_index_()
+    {
+        static std::atomic<std::size_t> next_slot_index{0};
+        thread_local const std::size_t slot_index{next_slot_index.fetch_add(1, std::memory_order_relaxed) % READER_SLOT_COUNT};
+
+        return slot_index;
+    }
+}
+
+#endif // SIMPLE_ARG_PARSER_RCU_HPP
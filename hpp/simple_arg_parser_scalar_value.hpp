@@ -48,6 +48,8 @@ namespace SimpleArgParser::Internals_
         T& get_value()              { return get_value_(); };
         const T& get_value() const  { return get_value_(); };
 
+        bool refers_to_external_value() const { return std::holds_alternative<T*>(value_); }
+
     private:
 
         T& get_value_()
@@ -0,0 +1,129 @@
+// Copyright 2025 arkanarian-a
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is furnished
+// to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef SIMPLE_ARG_PARSER_SCHEMA_INDEX_HPP
+#define SIMPLE_ARG_PARSER_SCHEMA_INDEX_HPP
+
+// This file contains SchemaIndex, the read-only view of the option schema exported by Parser::export_schema_index(...)
+// for shell completion. The header doesn't depend on the Parser, so the completion entry point of an application may
+// answer prefix queries from the index mapped without constructing the Parser (its options, handlers, etc.):
+//
+//   int main(int argc, const char* argv[])
+//   {
+//       if (argc == 3 && argv[1] == "--complete"sv)
+//           return SAP::SchemaIndex::open(SCHEMA_INDEX_PATH).output_completions(argv[2], std::cout) ? 0 : 1;
+//       ...
+//   }
+//
+// The index file is laid out as Header_, the records of the keys, aliases and subcommand names sorted (bytewise), and
+// the strings the records refer to by offsets.
+
+#include <span>
+#include <cstdint>
+#include <cstddef>
+#include <ostream>
+#include <string_view>
+
+
+namespace SimpleArgParser
+{
+    class Parser;
+
+    class SchemaIndex
+    // Option schema index mapped read-only. Prefix queries are answered by binary search over the sorted records.
+    {
+    public:
+
+        enum class EntryKind: std::uint8_t
+        {
+            Switch = 0
+        ,   Scalar
+        ,   Vectored
+        ,   Subcommand
+        };
+
+        struct EntryRecord
+        // Record of a key, an alias or a subcommand name (the strings are read with SchemaIndex accessors)
+        {
+            std::uint32_t   key_offset;
+            std::uint32_t   key_size;
+            std::uint32_t   canonical_key_offset;   // The option key (for both the key and its alias)
+            std::uint32_t   canonical_key_size;
+            std::uint32_t   description_offset;
+            std::uint32_t   description_size;
+            std::uint16_t   item_token_count;       // Number of tokens representing a value item (0 for switches and subcommands)
+            EntryKind       kind;
+            std::uint8_t    reserved{0};
+        };
+
+        SchemaIndex(SchemaIndex&&) noexcept;
+        SchemaIndex(const SchemaIndex&) = delete;
+
+        SchemaIndex& operator=(SchemaIndex&&) = delete;
+        SchemaIndex& operator=(const SchemaIndex&) = delete;
+
+        ~SchemaIndex();
+
+        static SchemaIndex open(const char*);
+        // Map the index file read-only and validate its layout. Throws IndexFileFailure or IndexLayoutMismatch.
+
+        std::span<const EntryRecord> entries() const { return {entries_, entry_count_}; }
+        // Get all the records (sorted by keys).
+        std::span<const EntryRecord> complete(std::string_view) const;
+        // Get the records of the keys starting with the prefix (sorted by keys).
+
+        std::string_view key(const EntryRecord& record) const           { return string_(record.key_offset, record.key_size); }
+        std::string_view canonical_key(const EntryRecord& record) const { return string_(record.canonical_key_offset, record.canonical_key_size); }
+        std::string_view description(const EntryRecord& record) const   { return string_(record.description_offset, record.description_size); }
+
+        std::size_t output_completions(std::string_view, std::ostream&, bool = false) const;
+        // Output the keys starting with the prefix one per line (followed by '\t' and their descriptions, if requested).
+        // Returns the number of the keys output.
+
+    private:
+
+        friend class Parser;
+
+        static constexpr char           MAGIC[8]{'S', 'A', 'P', 'S', 'C', 'H', 'E', 'M'};
+        static constexpr std::uint32_t  LAYOUT_VERSION{1};
+
+        struct Header_
+        {
+            char            magic[8];
+            std::uint32_t   layout_version;
+            std::uint32_t   entry_count;
+            std::uint64_t   strings_offset;     // Offset of the strings (the records follow the header)
+            std::uint64_t   size;               // Size of the index
+        };
+
+        SchemaIndex(const std::byte* base, std::size_t size) : base_(base), size_(size) {}
+
+        std::string_view string_(std::uint32_t offset, std::uint32_t size) const
+        {
+            return {strings_ + offset, size};
+        }
+
+        const std::byte*    base_;
+        std::size_t         size_;
+        const EntryRecord*  entries_{nullptr};
+        std::size_t         entry_count_{0};
+        const char*         strings_{nullptr};
+    };
+}
+
+#endif // SIMPLE_ARG_PARSER_SCHEMA_INDEX_HPP
@@ -0,0 +1,247 @@
+// Copyright 2025 arkanarian-a
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is furnished
+// to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef SIMPLE_ARG_PARSER_SHARED_CONFIGURATION_HPP
+#define SIMPLE_ARG_PARSER_SHARED_CONFIGURATION_HPP
+
+// This file contains SharedConfiguration, the publication of parsed option values to worker processes through a POSIX
+// shared memory segment.
+//
+// The segment is relocatable (it refers to its parts by offsets from its beginning, never by pointers), so it may be
+// mapped at any address. It's laid out as follows (each part is aligned to IOptionIO::VALUE_IMAGE_ALIGNMENT):
+//
+//   Header_                            magic (written last), layout version, counts, segment size and part offsets
+//   Entry_[option_count]               option value descriptions (by option ordinals)
+//   KeyRecord_[key_count]              option keys and aliases sorted (for key lookup by binary search)
+//   key characters
+//   value images                       see IOptionIO::value_image(...): trivially copyable values are copied as they are
+//                                      (vectored value items contiguously), strings as (offset, size) records and bytes
+//
+// The values of other types (having neither trivially copyable representation nor string one) are not published, and
+// neither are pointers and spans (see Internals_::HasRelocatableImage), which mean nothing in another process.
+// Value types are identified by the hash of their std::type_info names, so the publisher and the readers MUST be built
+// with the same compiler (the supervisor and its workers are usually the same executable anyway).
+
+#include <span>
+#include <string>
+#include <cstdint>
+#include <cstring>
+#include <typeinfo>
+#include <string_view>
+#include <type_traits>
+#include "simple_arg_parser_iostream_handlers.hpp"
+#include "simple_arg_parser_exceptions.hpp"
+
+
+namespace SimpleArgParser
+{
+// ------------
+// Declarations
+// ------------
+    class Parser;
+
+    template <typename T>
+    using SharedValue = std::conditional_t<std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>, std::string_view, const T&>;
+    // Type of option value (or value item) read from SharedConfiguration: strings are read as views of the segment.
+
+    class SharedConfiguration
+    // Read-only view of the option values published by a Parser to a POSIX shared memory segment. Values are read in
+    // place with typed accessors (no inputter is run, nothing is copied), and they stay valid while the view exists.
+    {
+    public:
+
+        using ValueImageKind = Internals_::IOptionIO::ValueImageKind;
+
+        SharedConfiguration(SharedConfiguration&&) noexcept;
+        SharedConfiguration(const SharedConfiguration&) = delete;
+
+        SharedConfiguration& operator=(SharedConfiguration&&) = delete;
+        SharedConfiguration& operator=(const SharedConfiguration&) = delete;
+
+        ~SharedConfiguration();
+
+        static void publish(const Parser&, const std::string&, unsigned int mode = 0600);
+        // Publish the option values of the parser (its own options, not the ones of its subcommands) to the segment named
+        // (like "/app-config"). The segment is sized exactly in a first pass over the values and filled in a second one,
+        // and its magic is written last, so a process attaching the segment before it's complete gets SegmentLayoutMismatch.
+        // An existing segment of the name is unlinked first, so the processes which have attached it keep reading the
+        // values published before (a process attaching meanwhile may fail to find the segment).
+        static SharedConfiguration attach(const std::string&);
+        // Map the segment read-only and validate its layout. Throws SegmentOperationFailure or SegmentLayoutMismatch.
+        static void remove(const std::string&);
+        // Unlink the segment (the processes which have attached it keep their mappings).
+
+        template <typename T>
+        SharedValue<T> get_value(std::string_view) const;
+        // Get the scalar option value by the option key (of the same type as Option::get_value<T>() takes).
+        // Throws AccessingValueTypeMismatch if the value is not of type T or it's vectored.
+        template <typename T>
+        std::span<const T> get_items(std::string_view) const;
+        // Get the items of vectored value of trivially copyable type T (T is the item type).
+        template <typename T>
+        SharedValue<T> get_item(std::string_view, std::size_t) const;
+        // Get an item of vectored value by its index (strings included).
+
+        std::size_t item_count(std::string_view) const;
+        // Get the number of value items (1 for scalar values).
+        bool is_specified(std::string_view) const;
+        // Check whether the option had been specified when the values were published.
+        bool switch_is_on(std::string_view) const;
+        // Get the switch state. Throws AccessingValueTypeMismatch if the option is not a switch.
+
+        std::size_t size() const { return size_; }
+        // Get the segment size in bytes.
+
+    private:
+
+        static constexpr char           MAGIC[8]{'S', 'A', 'P', 'S', 'H', 'C', 'F', 'G'};
+        static constexpr std::uint32_t  LAYOUT_VERSION{1};
+
+        struct Header_
+        {
+            char            magic[8];
+            std::uint32_t   layout_version;
+            std::uint32_t   option_count;
+            std::uint64_t   key_count;          // Number of keys and aliases indexed
+            std::uint64_t   segment_size;
+            std::uint64_t   entries_offset;
+            std::uint64_t   key_records_offset;
+        };
+
+        struct Entry_
+        // Description of an option value
+        {
+            std::uint64_t   type_hash;          // Hash of the value (item) type name (0 for switches and unavailable values)
+            std::uint64_t   value_offset;       // Offset of the value image
+            std::uint64_t   item_count;
+            std::uint32_t   item_size;          // Size of trivially copyable items
+            ValueImageKind  kind;
+            bool            is_vectored;
+            bool            is_specified;
+            bool            is_switch_on;
+        };
+
+        struct KeyRecord_
+        {
+            std::uint64_t   key_offset;
+            std::uint32_t   key_size;
+            std::uint32_t   ordinal;            // Option ordinal (index of its entry)
+        };
+
+        SharedConfiguration(const std::byte* base, std::size_t size) : base_(base), size_(size) {}
+
+        template <typename T>
+        static std::uint64_t type_hash_();
+        // Get the hash of the type name (computed once per type).
+        static std::uint64_t type_hash_(std::string_view);
+
+        const Header_& header_() const { return *reinterpret_cast<const Header_*>(base_); }
+        const Entry_& entry_(std::string_view) const;
+        // Find the value entry by option key. Throws UndeclaredOptionOrWrongOptionKey if the key is not published.
+        template <typename T>
+        const Entry_& typed_entry_(std::string_view, bool) const;
+        // Find the value entry and check its type (and whether the value is vectored).
+        template <typename T>
+        SharedValue<T> item_(const Entry_&, std::size_t) const;
+
+        const std::byte*    base_;
+        std::size_t         size_;
+    };
+
+
+// -----------
+// Definitions
+// -----------
+    template <typename T>
+    SharedValue<T> SharedConfiguration::get_value(std::string_view option_key) const
+    {
+        return item_<T>(typed_entry_<T>(option_key, false), 0);
+    }
+
+    template <typename T>
+    std::span<const T> SharedConfiguration::get_items(std::string_view option_key) const
+    {
+        const auto& entry{typed_entry_<T>(option_key, true)};
+
+        if (entry.kind != ValueImageKind::Trivial)
+            throw OptionAccessException::AccessingValueTypeMismatch{std::source_location::current()};
+
+        return {reinterpret_cast<const T*>(base_ + entry.value_offset), entry.item_count};
+    }
+
+    template <typename T>
+    SharedValue<T> SharedConfiguration::get_item(std::string_view option_key, std::size_t item_index) const
+    {
+        const auto& entry{typed_entry_<T>(option_key, true)};
+
+        if (item_index >= entry.item_count)
+            throw OptionAccessException::ValueItemIndexOutOfRange(option_key, item_index, entry.item_count, std::source_location::current());
+
+        return item_<T>(entry, item_index);
+    }
+
+    template <typename T>
+    std::uint64_t SharedConfiguration::type_hash_()
+    {
+        static const std::uint64_t hash{type_hash_(typeid(T).name())};
+
+        return hash;
+    }
+
+    template <typename T>
+    const SharedConfiguration::Entry_& SharedConfiguration::typed_entry_(std::string_view option_key, bool is_vectored) const
+    {
+        const auto& entry{entry_(option_key)};
+
+        // The item size is checked as well, since attach() validates the value images by their item sizes stored:
+        constexpr bool IS_STRING{std::is_same_v<SharedValue<T>, std::string_view>};
+
+        bool kind_matches
+        {
+            IS_STRING
+        ?   entry.kind == ValueImageKind::Strings
+        :   entry.kind == ValueImageKind::Trivial && entry.item_size == sizeof(T)
+        };
+
+        if (!kind_matches || entry.is_vectored != is_vectored || entry.type_hash != type_hash_<T>())
+            throw OptionAccessException::AccessingValueTypeMismatch{std::source_location::current()};
+
+        return entry;
+    }
+
+    template <typename T>
+    SharedValue<T> SharedConfiguration::item_(const Entry_& entry, std::size_t item_index) const
+    {
+        auto* image{base_ + entry.value_offset};
+
+        if constexpr (std::is_same_v<SharedValue<T>, std::string_view>)
+        {
+            Internals_::IOptionIO::StringImage string_image;
+
+            std::memcpy(&string_image, image + item_index * sizeof(string_image), sizeof(string_image));
+
+            return {reinterpret_cast<const char*>(image + string_image.offset), string_image.size};
+        }
+        else
+        {
+            return reinterpret_cast<const T*>(image)[item_index];
+        }
+    }
+}
+
+#endif // SIMPLE_ARG_PARSER_SHARED_CONFIGURATION_HPP
@@ -20,7 +20,7 @@
 #define SIMPLE_ARG_PARSER_SPEC_VALUE_TRAITS_HPP
 
 // This file contains ValueTraits<T> specializations for T substituted as SimpleArgParser::SwitchState, bool, std::string,
-// and std::chrono::system_clock::time_point types.
+// std::chrono::system_clock::time_point, SimpleArgParser::ByteSize and std::chrono::duration types.
 //
 // Include this file into you code, only if you need these specializations. Alternatively, you may write your own
 // spetializations for these types. Also, you may redefine some of the default specializations in this file by
@@ -34,19 +34,156 @@
 //                                                               specialization.
 //                                                               (NOTE double undescore between 'STD' and 'TIME' inside
 //                                                               the macro name, please, it's intended!)
+// SIMPLE_ARG_PARSER_DISABLE_VALUE_TRAITS_BYTE_SIZE_SPEC - to disable default ValueTraits<ByteSize> specialization;
+// SIMPLE_ARG_PARSER_DISABLE_VALUE_TRAITS_STD__DURATION_SPEC - to disable default ValueTraits<std::chrono::duration<...>>
+//                                                             specialization.
 // NOTE: add a comment '// IWYU pragma: keep' after the #include statement to suppress the CLang warning, which is
 //       redundantly paranoic for this case.
 //       Resulting line should be like this:
 //       #include "simple_arg_parser_spec_value_traits.hpp" // IWYU pragma: keep
 
 #include <iomanip>
+#include <sstream>
 #include <chrono>
+#include <array>
+#include <limits>
+#include <cstdint>
+#include <compare>
+#include <numeric>
+#include <charconv>
 #include "simple_arg_parser_compiler_fine_tunes.hpp"
 #include "simple_arg_parser_iostream_handlers.hpp"
 #include "simple_arg_parser_switch_state.hpp"
 
 namespace SimpleArgParser
 {
+    struct ByteSize
+    // Size in bytes represented with a unit suffix (like 64MiB, 1.5G or 512).
+    {
+        std::uint64_t bytes{0};
+
+        friend auto operator<=>(const ByteSize&, const ByteSize&) = default;
+    };
+
+    namespace Internals_
+    {
+        struct UnitSuffix
+        // A unit suffix of a value representation with its scale (in bytes or nanoseconds). Aliases are accepted on
+        // input only, the values are output with the other suffixes.
+        {
+            std::string_view    suffix;
+            std::uint64_t       scale;
+            bool                is_alias{false};
+        };
+
+        inline constexpr std::array<UnitSuffix, 26> BYTE_SIZE_SUFFIXES
+        // Binary (IEC) and decimal (SI) byte size units. The binary ones are listed first to be preferred for output.
+        {{
+            {"EiB", 1ull << 60}, {"PiB", 1ull << 50}, {"TiB", 1ull << 40}, {"GiB", 1ull << 30}, {"MiB", 1ull << 20}, {"KiB", 1ull << 10}
+        ,   {"Ei", 1ull << 60, true}, {"Pi", 1ull << 50, true}, {"Ti", 1ull << 40, true}, {"Gi", 1ull << 30, true}
+        ,   {"Mi", 1ull << 20, true}, {"Ki", 1ull << 10, true}
+        ,   {"EB", 1'000'000'000'000'000'000ull}, {"PB", 1'000'000'000'000'000ull}, {"TB", 1'000'000'000'000ull}
+        ,   {"GB", 1'000'000'000ull}, {"MB", 1'000'000ull}, {"KB", 1'000ull}, {"kB", 1'000ull, true}
+        ,   {"E", 1'000'000'000'000'000'000ull, true}, {"P", 1'000'000'000'000'000ull, true}, {"T", 1'000'000'000'000ull, true}
+        ,   {"G", 1'000'000'000ull, true}, {"M", 1'000'000ull, true}, {"K", 1'000ull, true}, {"k", 1'000ull, true}
+        }};
+
+        inline constexpr std::array<UnitSuffix, 8> DURATION_SUFFIXES
+        // Duration units (in nanoseconds) ordered from the largest to the smallest one (the order is used for output).
+        {{
+            {"d", 86'400'000'000'000ull}, {"h", 3'600'000'000'000ull}, {"m", 60'000'000'000ull}, {"min", 60'000'000'000ull, true}
+        ,   {"s", 1'000'000'000ull}, {"ms", 1'000'000ull}, {"us", 1'000ull}, {"ns", 1ull}
+        }};
+
+        struct UnitQuantity
+        // A number with a unit suffix parsed from a token (like 1.5 and "G" of "1.5G"). The fractional part is kept as
+        // a decimal fraction (like 5/10), so its scaling is exact.
+        {
+            std::uint64_t       integer_part{0};
+            std::uint64_t       fraction_numerator{0};
+            std::uint64_t       fraction_denominator{1};
+            std::string_view    suffix;
+        };
+
+        inline const char* parse_unit_quantity(const char* first, const char* last, UnitQuantity& quantity)
+        // Parse the number (with optional fractional part of up to 18 digits) and the following suffix letters with
+        // std::from_chars. Returns the pointer to the first character after the suffix or nullptr on failure.
+        {
+            constexpr std::uint64_t MAX_FRACTION_DENOMINATOR{1'000'000'000'000'000'000ull};
+
+            auto [ptr, ec] = std::from_chars(first, last, quantity.integer_part);
+
+            if (ec != std::errc{})
+                return nullptr;
+
+            quantity.fraction_numerator = 0;
+            quantity.fraction_denominator = 1;
+
+            if (ptr != last && *ptr == '.')
+            {
+                for (++ptr; ptr != last && *ptr >= '0' && *ptr <= '9'; ++ptr)
+                {
+                    if (quantity.fraction_denominator == MAX_FRACTION_DENOMINATOR)
+                        return nullptr;
+
+                    quantity.fraction_numerator = quantity.fraction_numerator * 10 + (*ptr - '0');
+                    quantity.fraction_denominator*=10;
+                }
+            }
+
+            auto suffix_first{ptr};
+
+            while (ptr != last && ((*ptr >= 'a' && *ptr <= 'z') || (*ptr >= 'A' && *ptr <= 'Z')))
+                ++ptr;
+
+            quantity.suffix = {suffix_first, static_cast<std::size_t>(ptr - suffix_first)};
+
+            return ptr;
+        }
+
+        template <std::size_t N>
+        const UnitSuffix* find_unit_suffix(const std::array<UnitSuffix, N>& suffixes, std::string_view suffix)
+        {
+            for (const auto& unit_suffix : suffixes)
+                if (unit_suffix.suffix == suffix) return &unit_suffix;
+
+            return nullptr;
+        }
+
+        inline bool is_whole_unit_quantity(const UnitQuantity& quantity, std::uint64_t scale)
+        // Check whether the quantity multiplied by its unit scale is a whole number (like 1.5K, but not 1.5 or 1.0001K).
+        {
+            // fraction_numerator / fraction_denominator * scale is whole if the reduced denominator divides the numerator:
+            return quantity.fraction_numerator % (quantity.fraction_denominator / std::gcd(quantity.fraction_denominator, scale)) == 0;
+        }
+
+        inline bool scale_unit_quantity(const UnitQuantity& quantity, std::uint64_t scale, std::uint64_t& result)
+        // Multiply the quantity by its unit scale with overflow check, truncating the fraction of the smallest unit.
+        // Returns false on overflow.
+        {
+            constexpr auto MAX{std::numeric_limits<std::uint64_t>::max()};
+
+            if (quantity.integer_part > MAX / scale)
+                return false;
+
+            // The scaled fraction is less than the scale, and its whole part of the reduced fraction is computed exactly:
+            auto divisor{std::gcd(quantity.fraction_denominator, scale)};
+            auto reduced_denominator{quantity.fraction_denominator / divisor}, reduced_scale{scale / divisor};
+            auto fraction
+            {
+                quantity.fraction_numerator / reduced_denominator * reduced_scale
+            +   static_cast<std::uint64_t>(static_cast<long double>(quantity.fraction_numerator % reduced_denominator) * reduced_scale / reduced_denominator)
+            };
+
+            if (quantity.integer_part * scale > MAX - fraction)
+                return false;
+
+            result = quantity.integer_part * scale + fraction;
+
+            return true;
+        }
+    }
+
 #ifndef SIMPLE_ARG_PARSER_DISABLE_VALUE_TRAITS_SWITCH_STATE_SPEC
     template <>
     struct ValueTraits<SwitchState>
@@ -117,26 +254,468 @@ namespace SimpleArgParser
 #endif
 
 #ifndef SIMPLE_ARG_PARSER_DISABLE_VALUE_TRAITS_STD__TIME_POINT_SPEC
+    namespace Internals_
+    {
+        struct TimePointLayout
+        // Pre-compiled layout of a common ISO-8601 time point format (YYYY-MM-DD hh:mm:ss or YYYY-MM-DDThh:mm:ss with
+        // optional fractional seconds and zone offset). The formats not recognized are handled by std::chrono facilities.
+        {
+            std::string_view    format{};                   // The format recognized (empty if the format is not recognized)
+            char                date_time_separator{' '};   // ' ' or 'T'
+            bool                zone_offset{false};         // Zone offset (Z, +hh:mm or +hhmm) follows the time (parsing only)
+            char                quote_mark{'\0'};           // Quote mark enclosing the output ('\0' if none)
+        };
+
+        inline constexpr std::array<TimePointLayout, 6> TIME_POINT_PARSING_LAYOUTS
+        {{
+            {"%F %T", ' ', false}, {"%FT%T", 'T', false}
+        ,   {"%F %T%z", ' ', true}, {"%FT%T%z", 'T', true}, {"%F %T%Ez", ' ', true}, {"%FT%T%Ez", 'T', true}
+        }};
+
+        inline constexpr std::array<TimePointLayout, 6> TIME_POINT_OUTPUT_LAYOUTS
+        {{
+            {"{0:%F} {0:%T}", ' '}, {"{0:%F}T{0:%T}", 'T'}
+        ,   {"'{0:%F} {0:%T}'", ' ', false, '\''}, {"'{0:%F}T{0:%T}'", 'T', false, '\''}
+        ,   {"\"{0:%F} {0:%T}\"", ' ', false, '"'}, {"\"{0:%F}T{0:%T}\"", 'T', false, '"'}
+        }};
+
+        inline TimePointLayout compile_time_point_layout(std::string_view format, const std::array<TimePointLayout, 6>& layouts)
+        {
+            for (const auto& layout : layouts)
+                if (layout.format == format) return layout;
+
+            return {};
+        }
+
+        template <typename Duration>
+        constexpr int fractional_second_digits()
+        // Number of decimal digits of fractional seconds for Duration (or -1 if its period is not a decimal fraction of second).
+        {
+            using Period = typename Duration::period;
+
+            if constexpr (Period::num != 1)
+                return Period::den == 1 ? 0 : -1;
+            else
+            {
+                int digits{0};
+
+                for (auto den{Period::den}; den > 1; den/=10, ++digits)
+                    if (den % 10) return -1;
+
+                return digits;
+            }
+        }
+
+        inline bool parse_fixed_digits(const char*& ptr, const char* last, int count, int& value)
+        {
+            if (last - ptr < count)
+                return false;
+
+            for (value = 0; count--; ++ptr)
+            {
+                if (*ptr < '0' || *ptr > '9')
+                    return false;
+
+                value = value * 10 + (*ptr - '0');
+            }
+
+            return true;
+        }
+
+        template <typename Duration>
+        bool parse_time_point(std::string_view token, const TimePointLayout& layout, std::chrono::sys_time<Duration>& tp)
+        // Hand-rolled parsing of the time point with the layout. Returns false if the token doesn't match the layout exactly.
+        {
+            constexpr auto FRACTION_DIGITS{fractional_second_digits<Duration>()};
+
+            auto ptr{token.data()}, last{token.data() + token.size()};
+            int year, month, day, hours, minutes, seconds;
+
+            auto expect = [&ptr, last] (char c) { return ptr != last && *ptr++ == c; };
+
+            if
+            (
+                !parse_fixed_digits(ptr, last, 4, year) || !expect('-')
+            ||  !parse_fixed_digits(ptr, last, 2, month) || !expect('-')
+            ||  !parse_fixed_digits(ptr, last, 2, day) || !expect(layout.date_time_separator)
+            ||  !parse_fixed_digits(ptr, last, 2, hours) || !expect(':')
+            ||  !parse_fixed_digits(ptr, last, 2, minutes) || !expect(':')
+            ||  !parse_fixed_digits(ptr, last, 2, seconds)
+            ||  hours > 23 || minutes > 59 || seconds > 59
+            )
+                return false;
+
+            std::chrono::year_month_day date{std::chrono::year(year), std::chrono::month(month), std::chrono::day(day)};
+
+            if (!date.ok())
+                return false;
+
+            Duration fraction{0};
+
+            if (ptr != last && *ptr == '.')
+            {
+                if constexpr (FRACTION_DIGITS <= 0)
+                    return false;
+                else
+                {
+                    typename Duration::rep fraction_count{0};
+                    int digits{0};
+
+                    for (++ptr; ptr != last && *ptr >= '0' && *ptr <= '9' && digits < FRACTION_DIGITS; ++ptr, ++digits)
+                        fraction_count = fraction_count * 10 + (*ptr - '0');
+
+                    if (digits == 0 || (ptr != last && *ptr >= '0' && *ptr <= '9'))
+                        return false;
+
+                    for (; digits < FRACTION_DIGITS; ++digits)
+                        fraction_count*=10;
+
+                    fraction = Duration(fraction_count);
+                }
+            }
+
+            std::chrono::minutes offset{0};
+
+            if (layout.zone_offset)
+            {
+                if (ptr != last && *ptr == 'Z')
+                    ++ptr;
+                else if (ptr != last && (*ptr == '+' || *ptr == '-'))
+                {
+                    auto sign{*ptr++ == '-' ? -1 : 1};
+                    int offset_hours, offset_minutes;
+
+                    if (!parse_fixed_digits(ptr, last, 2, offset_hours))
+                        return false;
+
+                    if (ptr != last && *ptr == ':')
+                        ++ptr;
+
+                    if (!parse_fixed_digits(ptr, last, 2, offset_minutes) || offset_minutes > 59)
+                        return false;
+
+                    offset = sign * (std::chrono::hours(offset_hours) + std::chrono::minutes(offset_minutes));
+                }
+                else
+                    return false;
+            }
+
+            if (ptr != last)
+                return false;
+
+            tp =
+                std::chrono::sys_days(date)
+            +   std::chrono::hours(hours) + std::chrono::minutes(minutes) + std::chrono::seconds(seconds)
+            +   fraction
+            -   offset
+            ;
+
+            return true;
+        }
+
+        template <typename Duration>
+        char* format_time_point(char* first, char* last, const TimePointLayout& layout, const std::chrono::sys_time<Duration>& tp)
+        // Hand-rolled output of the time point with the layout (the same as std::format does for %F and %T).
+        // Returns the pointer past the last character written or nullptr if the buffer is too small or the year is out of 0...9999.
+        {
+            constexpr auto FRACTION_DIGITS{fractional_second_digits<Duration>()};
+
+            auto day_start{std::chrono::floor<std::chrono::days>(tp)};
+            std::chrono::year_month_day date{day_start};
+            std::chrono::hh_mm_ss time{tp - day_start};
+            int year{static_cast<int>(date.year())};
+
+            auto required_size{19 + (FRACTION_DIGITS > 0 ? FRACTION_DIGITS + 1 : 0) + (layout.quote_mark ? 2 : 0)};
+
+            if (year < 0 || year > 9999 || last - first < required_size)
+                return nullptr;
+
+            auto put_digits = [&first] (long long value, int count)
+            {
+                for (auto digit{first + count}; digit != first; value/=10)
+                    *--digit = static_cast<char>('0' + value % 10);
+
+                first+=count;
+            };
+
+            if (layout.quote_mark) *first++ = layout.quote_mark;
+
+            put_digits(year, 4);
+            *first++ = '-';
+            put_digits(static_cast<unsigned>(date.month()), 2);
+            *first++ = '-';
+            put_digits(static_cast<unsigned>(date.day()), 2);
+            *first++ = layout.date_time_separator;
+            put_digits(time.hours().count(), 2);
+            *first++ = ':';
+            put_digits(time.minutes().count(), 2);
+            *first++ = ':';
+            put_digits(time.seconds().count(), 2);
+
+            if constexpr (FRACTION_DIGITS > 0)
+            {
+                *first++ = '.';
+                put_digits(time.subseconds().count(), FRACTION_DIGITS);
+            }
+
+            if (layout.quote_mark) *first++ = layout.quote_mark;
+
+            return first;
+        }
+    }
+
     template <>
     struct ValueTraits<std::chrono::system_clock::time_point>: public TypeIndependentValueTraits
-    // For std::chrono::system_clock::time_point option value traits contain ...
+    // For std::chrono::system_clock::time_point option value traits contain format strings for parsing and output.
+    // The common ISO-8601 formats (see Internals_::TIME_POINT_PARSING_LAYOUTS and Internals_::TIME_POINT_OUTPUT_LAYOUTS)
+    // are pre-compiled when the traits object is built and then handled with hand-rolled digit parsing and formatting
+    // (without streams and allocations). Other formats are handled with std::chrono::parse and std::format.
     {
         std::optional<std::string> output(std::ostream& os, const std::chrono::system_clock::time_point& tp) const
         {
-            os << runtime_format(output_formatter, tp);
+            std::array<char, 64> buffer;
+
+            if (auto* last{output_to(buffer.data(), buffer.data() + buffer.size(), tp)}; last)
+                os.write(buffer.data(), last - buffer.data());
+            else
+                os << runtime_format(output_formatter, tp);
 
             return std::nullopt; // Always successful
         }
 
+        char* output_to(char* first, char* last, const std::chrono::system_clock::time_point& tp) const
+        // Output the value into the caller buffer without allocations (for pre-compiled output format only).
+        // Returns the pointer past the last character written or nullptr if the value can't be output this way.
+        {
+            if (output_layout.format.empty() || output_layout.format != output_formatter)
+                return nullptr;
+
+            return Internals_::format_time_point(first, last, output_layout, tp);
+        }
+
         std::optional<std::string> input(std::istream& is, std::chrono::system_clock::time_point& tp) const
         {
+            // The default output is quoted (so it's a single token), so the quoted time point is read as a whole:
+            if (auto next_char{(is >> std::ws).peek()}; next_char == '\'' || next_char == '"')
+            {
+                std::string token;
+
+                is >> std::quoted(token, static_cast<char>(next_char));
+
+                return input_token(token, tp);
+            }
+
             is >> std::chrono::parse(parsing_formatter, tp);
 
             return std::nullopt; // Always successful
         }
 
+        std::optional<std::string> input_token(std::string_view token, std::chrono::system_clock::time_point& tp) const
+        // Allocation-free on success for pre-compiled parsing format. The token may be enclosed in the quote marks of the
+        // default output format (like the arguments made by Parser::make_argument_vector).
+        {
+            if (token.size() >= 2 && (token.front() == '\'' || token.front() == '"') && token.back() == token.front())
+                token = token.substr(1, token.size() - 2);
+
+            if (!parsing_layout.format.empty() && parsing_layout.format == parsing_formatter && Internals_::parse_time_point(token, parsing_layout, tp))
+                return std::nullopt;
+
+            std::istringstream is{std::string(token)};
+
+            if (!(is >> std::chrono::parse(parsing_formatter, tp)))
+                return std::format("Failed to convert '{}' to time point!", token);
+
+            return std::nullopt;
+        }
+
         std::string parsing_formatter{"%F %T"}; // ... format string for parsing a value of the type
         std::string output_formatter{"'{0:%F} {0:%T}'"}; // ... format string for outputting a value of the type.
+
+        // Layouts compiled from the format strings above when the traits object is built (the layouts are not used, if the
+        // format strings are changed afterwards):
+        Internals_::TimePointLayout parsing_layout{Internals_::compile_time_point_layout(parsing_formatter, Internals_::TIME_POINT_PARSING_LAYOUTS)};
+        Internals_::TimePointLayout output_layout{Internals_::compile_time_point_layout(output_formatter, Internals_::TIME_POINT_OUTPUT_LAYOUTS)};
+    };
+#endif
+
+#ifndef SIMPLE_ARG_PARSER_DISABLE_VALUE_TRAITS_BYTE_SIZE_SPEC
+    template <>
+    struct ValueTraits<ByteSize>: public TypeIndependentValueTraits
+    // ByteSize is represented by a number (possibly fractional) with optional unit suffix: decimal (k, K, KB, M, MB, ...,
+    // E, EB) or binary (Ki, KiB, Mi, MiB, ..., Ei, EiB) one. Plain number (or B suffix) means bytes. The value MUST be a
+    // whole number of bytes (1.5K is accepted, 1.5 is not).
+    // It's output with the largest suffix representing the value exactly (like 64MiB or 1500MB), so the output round-trips.
+    {
+        std::optional<std::string> output(std::ostream& os, ByteSize value) const
+        {
+            std::array<char, 32> buffer;
+            std::string_view suffix{"B"};
+            auto number{value.bytes};
+
+            // Canonical suffixes (not aliases) are tried in the table order, so the binary ones are preferred:
+            for (const auto& [unit_suffix, scale, is_alias] : Internals_::BYTE_SIZE_SUFFIXES)
+            {
+                if (!is_alias && number && number % scale == 0)
+                {
+                    number/=scale;
+                    suffix = unit_suffix;
+
+                    break;
+                }
+            }
+
+            auto ptr{std::to_chars(buffer.data(), buffer.data() + buffer.size(), number).ptr};
+
+            os.write(buffer.data(), ptr - buffer.data()) << suffix;
+
+            return std::nullopt;
+        }
+
+        std::optional<std::string> input(std::istream& is, ByteSize& value) const
+        {
+            std::string token;
+
+            if (!(is >> token))
+                return "Failed to read byte size from std::istream!";
+
+            return input_token(token, value);
+        }
+
+        std::optional<std::string> input_token(std::string_view token, ByteSize& value) const
+        // Allocation-free on success.
+        {
+            Internals_::UnitQuantity quantity;
+
+            if (Internals_::parse_unit_quantity(token.data(), token.data() + token.size(), quantity) != token.data() + token.size())
+                return std::format("Failed to convert '{}' to byte size!", token);
+
+            std::uint64_t scale{1};
+
+            if (!quantity.suffix.empty() && quantity.suffix != "B")
+            {
+                auto* unit_suffix{Internals_::find_unit_suffix(Internals_::BYTE_SIZE_SUFFIXES, quantity.suffix)};
+
+                if (!unit_suffix)
+                    return std::format("Unknown byte size unit '{}' in '{}'!", quantity.suffix, token);
+
+                scale = unit_suffix->scale;
+            }
+
+            if (!Internals_::is_whole_unit_quantity(quantity, scale))
+                return std::format("Byte size '{}' is not a whole number of bytes!", token);
+
+            if (!Internals_::scale_unit_quantity(quantity, scale, value.bytes))
+                return std::format("Byte size '{}' is out of range!", token);
+
+            return std::nullopt;
+        }
+    };
+#endif
+
+#ifndef SIMPLE_ARG_PARSER_DISABLE_VALUE_TRAITS_STD__DURATION_SPEC
+    template <typename Rep, typename Period>
+    struct ValueTraits<std::chrono::duration<Rep, Period>>: public TypeIndependentValueTraits
+    // std::chrono::duration is represented by a sequence of numbers (possibly fractional) with unit suffixes: d, h, m (or min),
+    // s, ms, us, ns (like 250ms, 1.5s or 2h30m), optionally preceded by '-' sign. The value is converted through nanoseconds
+    // and its conversion to a coarser integral duration type MUST be exact.
+    // It's output as a sequence of integral components (like 2h30m or 1s500ms), so the output round-trips.
+    {
+        using Duration = std::chrono::duration<Rep, Period>;
+
+        std::optional<std::string> output(std::ostream& os, const Duration& value) const
+        {
+            std::array<char, 32> buffer;
+            auto nanoseconds{std::chrono::duration_cast<std::chrono::nanoseconds>(value).count()};
+
+            if (nanoseconds == 0)
+            {
+                os << "0s";
+
+                return std::nullopt;
+            }
+
+            if (nanoseconds < 0)
+                os << '-';
+
+            auto remainder{nanoseconds < 0 ? 0ull - static_cast<std::uint64_t>(nanoseconds) : static_cast<std::uint64_t>(nanoseconds)};
+
+            for (const auto& [unit_suffix, scale, is_alias] : Internals_::DURATION_SUFFIXES)
+            {
+                if (is_alias || remainder < scale)
+                    continue;
+
+                auto ptr{std::to_chars(buffer.data(), buffer.data() + buffer.size(), remainder / scale).ptr};
+
+                os.write(buffer.data(), ptr - buffer.data()) << unit_suffix;
+
+                remainder%=scale;
+            }
+
+            return std::nullopt;
+        }
+
+        std::optional<std::string> input(std::istream& is, Duration& value) const
+        {
+            std::string token;
+
+            if (!(is >> token))
+                return "Failed to read duration from std::istream!";
+
+            return input_token(token, value);
+        }
+
+        std::optional<std::string> input_token(std::string_view token, Duration& value) const
+        // Allocation-free on success.
+        {
+            constexpr auto MAX_NANOSECONDS{static_cast<std::uint64_t>(std::numeric_limits<std::chrono::nanoseconds::rep>::max())};
+
+            auto first{token.data()}, last{token.data() + token.size()};
+            bool negative{first != last && *first == '-'};
+            std::uint64_t total{0};
+
+            if (negative)
+                ++first;
+
+            if (first == last)
+                return std::format("Failed to convert '{}' to duration!", token);
+
+            while (first != last)
+            {
+                Internals_::UnitQuantity quantity;
+                std::uint64_t component;
+
+                if (first = Internals_::parse_unit_quantity(first, last, quantity); !first)
+                    return std::format("Failed to convert '{}' to duration!", token);
+
+                auto* unit_suffix{Internals_::find_unit_suffix(Internals_::DURATION_SUFFIXES, quantity.suffix)};
+
+                if (!unit_suffix)
+                    return std::format("Missing or unknown duration unit '{}' in '{}'!", quantity.suffix, token);
+
+                if (!Internals_::scale_unit_quantity(quantity, unit_suffix->scale, component) || component > MAX_NANOSECONDS - total)
+                    return std::format("Duration '{}' is out of range!", token);
+
+                total+=component;
+            }
+
+            std::chrono::nanoseconds nanoseconds(negative ? -static_cast<std::int64_t>(total) : static_cast<std::int64_t>(total));
+
+            if constexpr (std::chrono::treat_as_floating_point_v<Rep>)
+            {
+                value = std::chrono::duration_cast<Duration>(nanoseconds);
+            }
+            else
+            {
+                auto converted{std::chrono::duration_cast<Duration>(nanoseconds)};
+
+                if (std::chrono::duration_cast<std::chrono::nanoseconds>(converted) != nanoseconds)
+                    return std::format("Duration '{}' is not representable by the option value type exactly!", token);
+
+                value = converted;
+            }
+
+            return std::nullopt;
+        }
     };
 #endif
 }
@@ -0,0 +1,82 @@
+// Copyright 2025 arkanarian-a
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is furnished
+// to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef SIMPLE_ARG_PARSER_THREAD_POOL_HPP
+#define SIMPLE_ARG_PARSER_THREAD_POOL_HPP
+
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <cstddef>
+#include <functional>
+#include <condition_variable>
+
+
+namespace SimpleArgParser::Internals_
+{
+    class ThreadPool
+    // Pool of worker threads running batches of indexed tasks (used by Parser for parallel option value conversion).
+    // The thread calling run(...) takes part in running its batch, so batches may be run from the tasks themselves
+    // (nested batches never dead-lock, even if all the workers are busy).
+    {
+    public:
+
+        using Task = std::function<void(std::size_t)>;
+
+        explicit ThreadPool(std::size_t);
+        // Start the workers (the number of hardware threads minus one, if zero is specified, since the calling thread works too).
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        ~ThreadPool();
+
+        std::size_t worker_count() const { return workers_.size(); }
+
+        void run(std::size_t, const Task&);
+        // Run the task for each index of 0...task_count-1 and wait for all of them to complete. The task MUST NOT throw
+        // (the exceptions are to be caught and kept by the task itself).
+
+    private:
+
+        struct Batch_
+        {
+            const Task*                 task;
+            std::size_t                 task_count;
+            std::atomic<std::size_t>    next_index{0};
+            std::atomic<std::size_t>    completed_count{0};
+        };
+
+        void run_task_(Batch_&, std::size_t);
+        // Run the task of the batch claimed by its index and count its completion.
+
+        void work_();
+        // Worker thread routine.
+
+        std::vector<std::thread>    workers_;
+        std::deque<Batch_*>         batches_;           // Batches having tasks not started yet
+        std::mutex                  mutex_;
+        std::condition_variable     work_available_;    // Signalled when a batch is queued or the pool is stopped
+        std::condition_variable     batch_completed_;   // Signalled when the last task of a batch completes
+        bool                        stopping_{false};
+    };
+}
+
+#endif // SIMPLE_ARG_PARSER_THREAD_POOL_HPP
@@ -152,6 +152,23 @@ namespace SimpleArgParser
         template <typename T>
         struct IsVector<VectoredValue<T>>: std::true_type
         {};
+
+        template <typename T>
+        struct VectoredValueFor
+        // Maps a vectored value container (or its wrapper) to the wrapper type kept in Option
+        {};
+
+        template <typename T>
+        struct VectoredValueFor<std::vector<T>>
+        {
+            using type = VectoredValue<T>;
+        };
+
+        template <typename T>
+        struct VectoredValueFor<VectoredValue<T>>
+        {
+            using type = VectoredValue<T>;
+        };
     }
 }
 
@@ -0,0 +1,143 @@
+// Copyright 2025 arkanarian-a
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is furnished
+// to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include <new>
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <string_view>
+#include <vector>
+#include <string>
+#include <chrono>
+#include "simple_arg_parser.hpp"
+#include "simple_arg_parser_spec_value_traits.hpp" // IWYU pragma: keep
+
+// -------------------------------------------------------------------------------------------------------------------
+// This program checks the allocation-free parsing guarantee (see "Allocation-free parsing" in readme.md): the global
+// operator new is replaced with a counting one, and Parser::parse of the value types guaranteed not to allocate must
+// make no allocations (the program fails otherwise). The allocations of other value types are reported for reference.
+// -------------------------------------------------------------------------------------------------------------------
+
+namespace SAP = SimpleArgParser;
+
+using namespace std::literals::string_view_literals;
+using namespace std::literals::chrono_literals;
+
+namespace
+{
+    std::atomic<std::size_t> allocation_count{0};
+
+    void* counted_allocation(std::size_t size)
+    {
+        allocation_count.fetch_add(1, std::memory_order_relaxed);
+
+        if (auto* memory{std::malloc(size ? size : 1)})
+            return memory;
+
+        throw std::bad_alloc{};
+    }
+
+    template <std::size_t ARGC>
+    std::size_t count_parse_allocations(SAP::Parser& parser, const char* (&argv)[ARGC])
+    // Count the allocations of parsing the arguments (the parser and the arguments are made beforehand).
+    {
+        auto allocations_before{allocation_count.load()};
+
+        parser.parse(ARGC, argv);
+
+        return allocation_count.load() - allocations_before;
+    }
+
+    bool check(std::string_view value_type, std::size_t allocations, bool must_be_allocation_free)
+    {
+        bool passed{!must_be_allocation_free || allocations == 0};
+
+        std::cout
+            << (must_be_allocation_free ? (passed ? "[ OK ]     " : "[ FAILED ] ") : "[ INFO ]   ")
+            << value_type << ": " << allocations << " allocation(s)\n";
+
+        return passed;
+    }
+}
+
+void* operator new(std::size_t size) { return counted_allocation(size); }
+void* operator new[](std::size_t size) { return counted_allocation(size); }
+void operator delete(void* memory) noexcept { std::free(memory); }
+void operator delete[](void* memory) noexcept { std::free(memory); }
+void operator delete(void* memory, std::size_t) noexcept { std::free(memory); }
+void operator delete[](void* memory, std::size_t) noexcept { std::free(memory); }
+
+
+int main()
+{
+    bool passed{true};
+
+    // Value types guaranteed to be parsed without allocations (including skipping an undeclared key):
+    {
+        SAP::Parser parser({ { {"--int"sv, "-i"sv}, 0 }, { {"--long"sv}, 0L }, { {"--unsigned"sv}, 0U } });
+        const char* argv[]{"prog", "--int", "-42", "--long", "1234567890123", "--undeclared", "-i", "7", "--unsigned", "42"};
+
+        passed&=check("int, long, unsigned", count_parse_allocations(parser, argv), true);
+    }
+    {
+        SAP::Parser parser({ { {"--float"sv}, 0.0f }, { {"--double"sv}, 0.0 } });
+        const char* argv[]{"prog", "--float", "2.5", "--double", "-1e-3"};
+
+        passed&=check("float, double", count_parse_allocations(parser, argv), true);
+    }
+    {
+        SAP::Parser parser({ { {"--switch"sv, "-s"sv}, SAP::Option::Omitted }, { {"--other"sv}, SAP::Option::Omitted } });
+        const char* argv[]{"prog", "-s", "--other"};
+
+        passed&=check("SwitchState", count_parse_allocations(parser, argv), true);
+    }
+    {
+        SAP::Parser parser({ { {"--name"sv}, std::string_view{} }, { {"--path"sv}, std::string_view{} } });
+        const char* argv[]{"prog", "--name", "allocation free", "--path", "/tmp"};
+
+        passed&=check("std::string_view", count_parse_allocations(parser, argv), true);
+    }
+
+    // Other value types (reported only):
+    {
+        SAP::Parser parser({ { {"--name"sv}, std::string{} } });
+        const char* argv[]{"prog", "--name", "a string longer than the small string buffer"};
+
+        check("std::string", count_parse_allocations(parser, argv), false);
+    }
+    {
+        SAP::Parser parser({ { {"--items"sv}, std::vector<int>{} } });
+        const char* argv[]{"prog", "--items", "1", "2", "3", "4", "5", "6", "7", "8"};
+
+        check("std::vector<int>", count_parse_allocations(parser, argv), false);
+    }
+    {
+        SAP::Parser parser({ { {"--xyz"sv}, SAP::InplaceVector<double, 3>{0, 0, 0}, SAP::StaticQuantifier<3, 3>{} } });
+        const char* argv[]{"prog", "--xyz", "1", "2", "3"};
+
+        check("SAP::InplaceVector<double, 3>", count_parse_allocations(parser, argv), false);
+    }
+    {
+        SAP::Parser parser({ { {"--timeout"sv}, std::chrono::milliseconds{0} } });
+        const char* argv[]{"prog", "--timeout", "1500ms"};
+
+        check("std::chrono::milliseconds", count_parse_allocations(parser, argv), false);
+    }
+
+    return passed ? 0 : 1;
+}
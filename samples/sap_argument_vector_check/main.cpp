@@ -0,0 +1,126 @@
+// Copyright 2025 arkanarian-a
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is furnished
+// to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include <chrono>
+#include <string>
+#include <memory>
+#include <vector>
+#include <iostream>
+#include <string_view>
+#include <source_location>
+#include "simple_arg_parser.hpp"
+#include "simple_arg_parser_spec_value_traits.hpp" // IWYU pragma: keep
+
+// -------------------------------------------------------------------------------------------------------------------
+// This program checks that the arguments made by Parser::make_argument_vector round-trip through Parser::parse (see
+// "Command line arguments of child processes" in readme.md): a parent parser parses the arguments, a child parser
+// declaring the same options with other defaults parses the argument vector made by the parent, and the values of
+// both must be equal (the program fails otherwise). String and time point items keep the quote marks of their
+// outputters, so the inputters of the child must accept them.
+// -------------------------------------------------------------------------------------------------------------------
+
+namespace SAP = SimpleArgParser;
+
+using namespace std::literals::string_literals;
+using namespace std::literals::string_view_literals;
+
+namespace
+{
+    using TimePoint = std::chrono::system_clock::time_point;
+
+    SAP::Parser* make_parser()
+    {
+        return new SAP::Parser
+        (
+            {
+                { {"--name"sv}, ""s }
+            ,   { {"--start"sv}, TimePoint{} }
+            ,   { {"--names"sv}, std::vector<std::string>{} }
+            ,   { {"--stamps"sv}, std::vector<TimePoint>{} }
+            ,   { {"--ids"sv}, std::vector<int>{} }
+            ,   { {"--verbose"sv}, SAP::Option::Omitted }
+            }
+        );
+    }
+
+    template <typename T>
+    bool check(std::string_view option_key, const SAP::Parser& parent, const SAP::Parser& child)
+    {
+        bool passed{parent[option_key].get_value<T>() == child[option_key].get_value<T>() && child.is_specified(option_key)};
+
+        std::cout << (passed ? "[ OK ]     " : "[ FAILED ] ") << option_key << ": " << child[option_key] << '\n';
+
+        return passed;
+    }
+}
+
+
+int main()
+{
+    try
+    {
+        std::unique_ptr<SAP::Parser> parent{make_parser()}, child{make_parser()};
+
+        const char* argv[]
+        {
+            "prog"
+        ,   "--name", "'two words and a \\'quote\\''"
+        ,   "--start", "2024-01-02 03:04:05.5"
+        ,   "--names", "'first item'", "second"
+        ,   "--stamps", "2024-01-02 03:04:05", "2024-01-03 00:00:00.25"
+        ,   "--ids", "1", "-2", "3"
+        ,   "--verbose"
+        };
+
+        parent->parse(std::size(argv), argv);
+
+        auto argument_vector{parent->make_argument_vector("child")};
+
+        std::cout << "Arguments:";
+
+        for (int argument_index{1}; argument_index < argument_vector.argc(); ++argument_index)
+            std::cout << " [" << argument_vector.argv()[argument_index] << ']';
+
+        std::cout << "\n\n";
+
+        child->parse(argument_vector.argc(), const_cast<const char**>(argument_vector.argv()));
+
+        bool passed{true};
+
+        passed&=check<std::string>("--name"sv, *parent, *child);
+        passed&=check<TimePoint>("--start"sv, *parent, *child);
+        passed&=check<std::vector<std::string>>("--names"sv, *parent, *child);
+        passed&=check<std::vector<TimePoint>>("--stamps"sv, *parent, *child);
+        passed&=check<std::vector<int>>("--ids"sv, *parent, *child);
+        passed&=check<SAP::SwitchState>("--verbose"sv, *parent, *child);
+
+        bool fingerprints_equal{parent->fingerprint() == child->fingerprint()};
+
+        std::cout << (fingerprints_equal ? "[ OK ]     " : "[ FAILED ] ") << "fingerprints\n";
+
+        passed&=fingerprints_equal;
+
+        return passed ? 0 : 1;
+    }
+    catch (const SAP::OptionException& oe)
+    {
+        oe.output(std::cerr, std::source_location::current());
+
+        return 1;
+    }
+}
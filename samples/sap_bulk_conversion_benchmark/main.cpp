@@ -0,0 +1,137 @@
+// Copyright 2025 arkanarian-a
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is furnished
+// to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+#include <iomanip>
+#include <iostream>
+#include "simple_arg_parser.hpp"
+
+// --------------------------------------------------------------------------------------------------------------------
+// Benchmark of the bulk conversion of large numeric vectored values (see simple_arg_parser_bulk_conversion.hpp): items per
+// second of Parser::parse of std::vector<int> and std::vector<double> values made of the same random decimal tokens,
+//   - looked up: a numeric-looking option key (+0) is declared, so every item is looked up as an option key,
+//   - skipped: no key looks like a number, so the key lookups of the items are skipped.
+// The items are converted from single tokens in a row in both cases (with std::from_chars). Run it like:
+//
+//   sap_bulk_conversion_benchmark --items 1000000 --repeats 10
+// --------------------------------------------------------------------------------------------------------------------
+
+namespace SAP = SimpleArgParser;
+
+using namespace std::literals::string_view_literals;
+
+namespace
+{
+    template <typename T>
+    double measure_items_per_second(bool declare_numeric_key, std::vector<const char*>& arguments, int repeats)
+    // Get the best items per second of the repeats.
+    {
+        SAP::Parser values_parser
+        (
+            declare_numeric_key
+        ?   std::initializer_list<SAP::Option>{ { {"--values"sv}, std::vector<T>{} }, { {"+0"sv}, 0 } }
+        :   std::initializer_list<SAP::Option>{ { {"--values"sv}, std::vector<T>{} } }
+        );
+
+        auto best{std::chrono::duration<double>::max()};
+
+        for (int repeat{0}; repeat < repeats; ++repeat)
+        {
+            auto start{std::chrono::steady_clock::now()};
+
+            values_parser.parse(static_cast<int>(arguments.size()), arguments.data());
+
+            best = std::min(best, std::chrono::duration<double>(std::chrono::steady_clock::now() - start));
+        }
+
+        if (values_parser["--values"sv].get_value<std::vector<T>>().size() != arguments.size() - 2)
+            std::cerr << "The items are not parsed entirely!\n";
+
+        return (arguments.size() - 2) / best.count();
+    }
+
+    void output_result(std::string_view name, double looked_up, double skipped)
+    {
+        std::cout
+            << std::setw(24) << std::left << name << std::right
+            << std::setw(14) << looked_up / 1e6 << std::setw(14) << skipped / 1e6 << std::setw(10) << skipped / looked_up << "x\n";
+    }
+}
+
+
+int main(int argc, const char* argv[])
+{
+    try
+    {
+        SAP::Parser parser
+        (
+            {
+                { {"--items"sv, "-n"sv}, std::size_t{1000000} }
+            ,   { {"--repeats"sv, "-r"sv}, 10 }
+            }
+        );
+
+        parser.parse(argc, argv);
+
+        auto item_count{parser["--items"sv].get_value<std::size_t>()};
+        auto repeats{parser["--repeats"sv].get_value<int>()};
+
+        // Tokens of 1 to 10 digits (a half of them negative) and the arguments of the benchmarked option made of them:
+        std::mt19937 generator{42};
+        std::uniform_int_distribution<int> values{std::numeric_limits<int>::min(), std::numeric_limits<int>::max()};
+        std::vector<std::string> tokens;
+        std::vector<const char*> arguments{"sap_bulk_conversion_benchmark", "--values"};
+
+        tokens.reserve(item_count);
+
+        for (std::size_t item_index{0}; item_index < item_count; ++item_index)
+            tokens.push_back(std::to_string(values(generator) >> (item_index % 31)));
+
+        for (const auto& token : tokens)
+            arguments.push_back(token.c_str());
+
+        std::cout
+            << std::fixed << std::setprecision(2)
+            << "Items: " << item_count << ", best of " << repeats << " repeats, Parser::parse throughput (M items/s)\n\n"
+            << std::setw(24) << std::left << "" << std::right << std::setw(14) << "looked up" << std::setw(14) << "skipped" << "\n";
+
+        output_result
+        (
+            "std::vector<int>"
+        ,   measure_items_per_second<int>(true, arguments, repeats)
+        ,   measure_items_per_second<int>(false, arguments, repeats)
+        );
+        output_result
+        (
+            "std::vector<double>"
+        ,   measure_items_per_second<double>(true, arguments, repeats)
+        ,   measure_items_per_second<double>(false, arguments, repeats)
+        );
+    }
+    catch (const SAP::OptionException& oe)
+    {
+        oe.output(std::cerr, std::source_location::current());
+
+        return 1;
+    }
+
+    return 0;
+}
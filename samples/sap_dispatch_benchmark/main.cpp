@@ -0,0 +1,151 @@
+// Copyright 2025 arkanarian-a
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is furnished
+// to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include <array>
+#include <chrono>
+#include <format>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include <utility>
+#include <iomanip>
+#include <iostream>
+#include <algorithm>
+#include "simple_arg_parser.hpp"
+
+// --------------------------------------------------------------------------------------------------------------------
+// Benchmark of the option dispatch of a parser with 5000 generated options (see Parser::memory_footprint()).
+// A quarter of the options are switches and the others take integers. The parser is constructed once, its memory
+// footprint is reported, then the argument line specifying every option once in random order is parsed repeatedly.
+// Run it like:
+//
+//   sap_dispatch_benchmark 20
+//
+// (the argument is the repeat count, 10 by default).
+// --------------------------------------------------------------------------------------------------------------------
+
+namespace SAP = SimpleArgParser;
+
+namespace
+{
+    constexpr std::size_t OPTION_COUNT{5000};
+
+    const std::array<std::string, OPTION_COUNT> OPTION_KEYS
+    {
+        []
+        {
+            std::array<std::string, OPTION_COUNT> keys;
+
+            for (std::size_t option_index{0}; option_index < OPTION_COUNT; ++option_index)
+                keys[option_index] = std::format("--generated-option-{:04}", option_index);
+
+            return keys;
+        }()
+    };
+
+    bool is_generated_switch(std::size_t option_index) { return option_index % 4 == 0; }
+
+    SAP::Option generate_option(std::size_t option_index)
+    {
+        if (is_generated_switch(option_index))
+            return { {OPTION_KEYS[option_index]}, SAP::Option::Omitted };
+
+        return { {OPTION_KEYS[option_index]}, 0 };
+    }
+
+    template <std::size_t... OPTION_INDICES>
+    SAP::Parser* generate_parser(std::index_sequence<OPTION_INDICES...>)
+    // The parser is constructed from an initializer list, so the generated options are expanded into one.
+    {
+        return new SAP::Parser({ generate_option(OPTION_INDICES)... });
+    }
+}
+
+
+int main(int argc, const char* argv[])
+{
+    try
+    {
+        auto repeats{argc > 1 ? std::max(std::atoi(argv[1]), 1) : 10};
+
+        auto construction_start{std::chrono::steady_clock::now()};
+        std::unique_ptr<SAP::Parser> parser{generate_parser(std::make_index_sequence<OPTION_COUNT>{})};
+        std::chrono::duration<double, std::milli> construction_time{std::chrono::steady_clock::now() - construction_start};
+
+        // Every option once, in random order:
+        std::vector<std::size_t> option_order(OPTION_COUNT);
+        std::vector<std::string> values;
+        std::vector<const char*> arguments{"sap_dispatch_benchmark"};
+
+        for (std::size_t option_index{0}; option_index < OPTION_COUNT; ++option_index)
+        {
+            option_order[option_index] = option_index;
+            values.push_back(std::to_string(option_index));
+        }
+
+        std::shuffle(option_order.begin(), option_order.end(), std::mt19937{42});
+
+        for (auto option_index : option_order)
+        {
+            arguments.push_back(OPTION_KEYS[option_index].c_str());
+
+            if (!is_generated_switch(option_index))
+                arguments.push_back(values[option_index].c_str());
+        }
+
+        auto best{std::chrono::duration<double, std::nano>::max()};
+
+        for (int repeat{0}; repeat < repeats; ++repeat)
+        {
+            auto start{std::chrono::steady_clock::now()};
+
+            parser->parse(static_cast<int>(arguments.size()), arguments.data());
+
+            best = std::min(best, std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start));
+        }
+
+        if ((*parser)[OPTION_KEYS[1]].get_value<int>() != 1 || !parser->switch_is_on(OPTION_KEYS[0]))
+        {
+            std::cerr << "Unexpected option values\n";
+
+            return 1;
+        }
+
+        auto footprint{parser->memory_footprint()};
+
+        std::cout
+            << "Options: " << footprint.option_count << ", arguments: " << arguments.size() - 1
+            << ", best of " << repeats << " repeats\n\n"
+            << std::fixed << std::setprecision(2)
+            << "Construction:        " << std::setw(10) << construction_time.count() << " ms\n"
+            << "Parse:               " << std::setw(10) << best.count() / 1'000'000 << " ms\n"
+            << "Dispatch per option: " << std::setw(10) << best.count() / OPTION_COUNT << " ns\n\n"
+            << "Hot bytes:           " << std::setw(10) << footprint.hot_bytes << " (" << footprint.hot_bytes_per_option() << " per option)\n"
+            << "Cold bytes:          " << std::setw(10) << footprint.cold_bytes << '\n'
+            << "Total bytes:         " << std::setw(10) << footprint.total_bytes() << " (" << footprint.bytes_per_option() << " per option)\n";
+    }
+    catch (const SAP::OptionException& oe)
+    {
+        oe.output(std::cerr, std::source_location::current());
+
+        return 1;
+    }
+
+    return 0;
+}
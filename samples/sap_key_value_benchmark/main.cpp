@@ -0,0 +1,174 @@
+// Copyright 2025 arkanarian-a
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is furnished
+// to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include <chrono>
+#include <string>
+#include <vector>
+#include <iomanip>
+#include <iostream>
+#include <algorithm>
+#include "simple_arg_parser.hpp"
+
+// --------------------------------------------------------------------------------------------------------------------
+// Benchmark of the argument forms enabled by ParsingPolicy::SplitKeyValueArguments and ParsingPolicy::ClusterShortSwitches:
+//   - --key=value arguments against --key value ones,
+//   - -abc switch clusters against -a -b -c switches,
+//   - vectored value items with these flags (and ParsingPolicy::AcceptKeyAbbreviations) off and on, since every item is
+//     checked for being a key-value argument, a switch cluster or a key abbreviation then.
+// Run it like:
+//
+//   sap_key_value_benchmark 20000
+//
+// (the argument is the parse count of the short argument lines, 10000 by default).
+// --------------------------------------------------------------------------------------------------------------------
+
+namespace SAP = SimpleArgParser;
+
+using namespace std::literals::string_view_literals;
+
+namespace
+{
+    double measure_ns_per_argument(SAP::Parser& parser, std::vector<const char*> arguments, int parse_count)
+    // Get the best time of three rounds of parse_count parses per argument parsed.
+    {
+        auto best{std::chrono::duration<double, std::nano>::max()};
+
+        for (int round{0}; round < 3; ++round)
+        {
+            auto start{std::chrono::steady_clock::now()};
+
+            for (int parse_index{0}; parse_index < parse_count; ++parse_index)
+                parser.parse(static_cast<int>(arguments.size()), arguments.data());
+
+            best = std::min(best, std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start));
+        }
+
+        return best.count() / parse_count / (arguments.size() - 1);
+    }
+
+    void output_result(std::string_view name, double ns_per_argument)
+    {
+        std::cout << std::setw(48) << std::left << name << std::right << std::setw(10) << ns_per_argument << " ns\n";
+    }
+
+    constexpr auto ARGUMENT_FORM_FLAGS
+    {
+        SAP::ParsingPolicy::SplitKeyValueArguments | SAP::ParsingPolicy::ClusterShortSwitches | SAP::ParsingPolicy::AcceptKeyAbbreviations
+    };
+}
+
+
+int main(int argc, const char* argv[])
+{
+    auto parse_count{argc > 1 ? std::max(std::atoi(argv[1]), 1) : 10000};
+
+    try
+    {
+        std::cout << std::fixed << std::setprecision(2);
+
+        // --key value against --key=value:
+        {
+            std::initializer_list<SAP::Option> options
+            {
+                { {"--alpha"sv}, 0 }, { {"--bravo"sv}, 0 }, { {"--charlie"sv}, 0 }, { {"--delta"sv}, 0 }
+            ,   { {"--echo"sv}, 0 }, { {"--foxtrot"sv}, 0 }, { {"--golf"sv}, 0 }, { {"--hotel"sv}, 0 }
+            };
+
+            SAP::Parser separate_parser(options);
+            SAP::Parser attached_parser(options, SAP::ParsingPolicy::SplitKeyValueArguments);
+
+            output_result
+            (
+                "--key value (per option)"
+            ,   measure_ns_per_argument
+                (
+                    separate_parser
+                ,   {"prog", "--alpha", "1", "--bravo", "2", "--charlie", "3", "--delta", "4", "--echo", "5", "--foxtrot", "6", "--golf", "7", "--hotel", "8"}
+                ,   parse_count
+                ) * 2 // <-- per option specified
+            );
+            output_result
+            (
+                "--key=value (per option)"
+            ,   measure_ns_per_argument
+                (
+                    attached_parser
+                ,   {"prog", "--alpha=1", "--bravo=2", "--charlie=3", "--delta=4", "--echo=5", "--foxtrot=6", "--golf=7", "--hotel=8"}
+                ,   parse_count
+                )
+            );
+        }
+
+        // -a -b -c against -abc:
+        {
+            std::initializer_list<SAP::Option> options
+            {
+                { {"--alpha"sv, "-a"sv}, SAP::Option::Omitted }, { {"--bravo"sv, "-b"sv}, SAP::Option::Omitted }
+            ,   { {"--charlie"sv, "-c"sv}, SAP::Option::Omitted }, { {"--delta"sv, "-d"sv}, SAP::Option::Omitted }
+            ,   { {"--echo"sv, "-e"sv}, SAP::Option::Omitted }, { {"--foxtrot"sv, "-f"sv}, SAP::Option::Omitted }
+            ,   { {"--golf"sv, "-g"sv}, SAP::Option::Omitted }, { {"--hotel"sv, "-h"sv}, SAP::Option::Omitted }
+            };
+
+            SAP::Parser separate_parser(options);
+            SAP::Parser clustering_parser(options, SAP::ParsingPolicy::ClusterShortSwitches);
+
+            output_result
+            (
+                "-a -b ... -h (per switch)"
+            ,   measure_ns_per_argument(separate_parser, {"prog", "-a", "-b", "-c", "-d", "-e", "-f", "-g", "-h"}, parse_count)
+            );
+            output_result
+            (
+                "-abcdefgh (per switch)"
+            ,   measure_ns_per_argument(clustering_parser, {"prog", "-abcdefgh"}, parse_count) / 8
+            );
+        }
+
+        // Vectored value items with the argument form flags off and on:
+        {
+            constexpr int ITEM_COUNT{10000};
+
+            std::vector<std::string> items;
+            std::vector<const char*> arguments{"prog", "--items"};
+
+            for (int item_index{0}; item_index < ITEM_COUNT; ++item_index)
+                items.push_back("item-" + std::to_string(item_index));
+
+            for (const auto& item : items)
+                arguments.push_back(item.c_str());
+
+            std::initializer_list<SAP::Option> options{ { {"--items"sv}, std::vector<std::string_view>{} }, { {"--other"sv}, 0 } };
+
+            SAP::Parser plain_parser(options);
+            SAP::Parser flagged_parser(options, ARGUMENT_FORM_FLAGS);
+
+            auto item_parse_count{std::max(parse_count / ITEM_COUNT * 10, 3)};
+
+            output_result("vectored items, form flags off (per item)", measure_ns_per_argument(plain_parser, arguments, item_parse_count));
+            output_result("vectored items, form flags on (per item)", measure_ns_per_argument(flagged_parser, arguments, item_parse_count));
+        }
+    }
+    catch (const SAP::OptionException& oe)
+    {
+        oe.output(std::cerr, std::source_location::current());
+
+        return 1;
+    }
+
+    return 0;
+}
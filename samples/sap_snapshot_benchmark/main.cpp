@@ -0,0 +1,233 @@
+// Copyright 2025 arkanarian-a
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is furnished
+// to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include <array>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <iomanip>
+#include <iostream>
+#include "simple_arg_parser.hpp"
+
+// --------------------------------------------------------------------------------------------------------------------
+// Reader scaling benchmark of option value snapshots (see "Option value snapshots for concurrent readers" in readme.md).
+// N reader threads acquire the object published last in a loop, while a publisher thread publishes a new one every
+// millisecond. The acquisitions per second of Internals_::RcuCell (reader counters spread over cache line sized slots)
+// are compared with the ones of SingleSlotCell below (the same algorithm with all the counters in one cache line), and
+// with the ones of Parser::acquire_snapshot() reading an option value. Run it on a machine of several cores, like:
+//
+//   sap_snapshot_benchmark --readers 1 2 4 8 16 --seconds 1
+// --------------------------------------------------------------------------------------------------------------------
+
+namespace SAP = SimpleArgParser;
+
+using namespace std::literals::string_view_literals;
+using namespace std::literals::chrono_literals;
+
+namespace
+{
+    struct Configuration
+    {
+        int     jobs;
+        double  ratio;
+    };
+
+    template <typename T>
+    class SingleSlotCell
+    // RcuCell<T> having one reader slot (the baseline the reader slots are measured against)
+    {
+    public:
+
+        class ReadGuard
+        {
+        public:
+
+            ReadGuard(const T* object_ptr, std::atomic<std::size_t>* counter_ptr) : object_ptr_(object_ptr), counter_ptr_(counter_ptr) {}
+            ReadGuard(const ReadGuard&) = delete;
+            ReadGuard& operator=(const ReadGuard&) = delete;
+
+            ~ReadGuard() { counter_ptr_->fetch_sub(1, std::memory_order_release); }
+
+            const T* operator->() const { return object_ptr_; }
+
+        private:
+
+            const T*                    object_ptr_;
+            std::atomic<std::size_t>*   counter_ptr_;
+        };
+
+        ~SingleSlotCell() { delete current_.load(); }
+
+        ReadGuard acquire() const
+        {
+            auto& counter{counters_[epoch_.load() & 1]};
+
+            counter.fetch_add(1);
+
+            return {current_.load(), &counter};
+        }
+
+        void publish(std::unique_ptr<const T> object)
+        {
+            std::lock_guard lock{publish_mutex_};
+
+            std::unique_ptr<const T> previous{current_.exchange(object.release())};
+
+            for (int phase{0}; phase < 2; ++phase)
+            {
+                auto parity{epoch_.fetch_add(1) & 1};
+
+                while (counters_[parity].load(std::memory_order_acquire) != 0) std::this_thread::yield();
+            }
+        }
+
+    private:
+
+        alignas(64) mutable std::array<std::atomic<std::size_t>, 2>    counters_{};
+        std::atomic<const T*>                                           current_{nullptr};
+        std::atomic<std::size_t>                                        epoch_{0};
+        std::mutex                                                      publish_mutex_;
+    };
+
+    template <typename Read, typename Publish>
+    double measure_acquisitions(int reader_count, std::chrono::duration<double> duration, Read read, Publish publish)
+    // Run the readers and the publisher for the duration, and get the acquisitions per second of all the readers.
+    {
+        std::atomic<bool> stop{false};
+        std::atomic<std::size_t> acquisitions{0};
+        std::vector<std::thread> readers;
+
+        for (int reader_index{0}; reader_index < reader_count; ++reader_index)
+        {
+            readers.emplace_back([&]
+            {
+                std::size_t reader_acquisitions{0};
+                long long checksum{0};
+
+                while (!stop.load(std::memory_order_relaxed))
+                {
+                    checksum+=read();
+                    ++reader_acquisitions;
+                }
+
+                acquisitions.fetch_add(reader_acquisitions + (checksum == -1));
+            });
+        }
+
+        std::thread publisher{[&]
+        {
+            for (int version{1}; !stop.load(std::memory_order_relaxed); ++version)
+            {
+                publish(version);
+                std::this_thread::sleep_for(1ms);
+            }
+        }};
+
+        std::this_thread::sleep_for(duration);
+        stop = true;
+
+        for (auto& reader : readers)
+            reader.join();
+
+        publisher.join();
+
+        return acquisitions.load() / duration.count();
+    }
+}
+
+
+int main(int argc, const char* argv[])
+{
+    try
+    {
+        SAP::Parser parser
+        (
+            {
+                { {"--readers"sv, "-r"sv}, std::vector<int>{1, 2, 4, 8} }
+            ,   { {"--seconds"sv, "-s"sv}, 1.0 }
+            ,   { {"--jobs"sv}, 1 }
+            }
+        );
+
+        parser.parse(argc, argv);
+
+        std::chrono::duration<double> duration{parser["--seconds"sv].get_value<double>()};
+
+        std::cout << "Hardware threads: " << std::thread::hardware_concurrency() << "\n\n";
+        std::cout << std::setw(8) << "readers" << std::setw(20) << "RcuCell, M/s" << std::setw(20) << "single slot, M/s" << std::setw(24) << "acquire_snapshot, M/s" << '\n';
+
+        for (auto reader_count : parser["--readers"sv].get_value<std::vector<int>>())
+        {
+            SAP::Internals_::RcuCell<Configuration> rcu_cell;
+            SingleSlotCell<Configuration> single_slot_cell;
+
+            rcu_cell.publish(std::make_unique<const Configuration>(Configuration{0, 0.5}));
+            single_slot_cell.publish(std::make_unique<const Configuration>(Configuration{0, 0.5}));
+            parser.publish_snapshot();
+
+            auto rcu_rate
+            {
+                measure_acquisitions
+                (
+                    reader_count, duration
+                ,   [&] { return rcu_cell.acquire()->jobs; }
+                ,   [&] (int version) { rcu_cell.publish(std::make_unique<const Configuration>(Configuration{version, 0.5})); }
+                )
+            };
+
+            auto single_slot_rate
+            {
+                measure_acquisitions
+                (
+                    reader_count, duration
+                ,   [&] { return single_slot_cell.acquire()->jobs; }
+                ,   [&] (int version) { single_slot_cell.publish(std::make_unique<const Configuration>(Configuration{version, 0.5})); }
+                )
+            };
+
+            auto snapshot_rate
+            {
+                measure_acquisitions
+                (
+                    reader_count, duration
+                ,   [&] { return parser.acquire_snapshot()->get_value<int>("--jobs"sv); }
+                ,   [&] (int) { parser.publish_snapshot(); }
+                )
+            };
+
+            std::cout
+                << std::fixed << std::setprecision(2)
+                << std::setw(8) << reader_count
+                << std::setw(20) << rcu_rate / 1e6
+                << std::setw(20) << single_slot_rate / 1e6
+                << std::setw(24) << snapshot_rate / 1e6
+                << '\n';
+        }
+    }
+    catch (const SAP::OptionException& oe)
+    {
+        oe.output(std::cerr, std::source_location::current());
+
+        return 1;
+    }
+
+    return 0;
+}
@@ -17,25 +17,57 @@
 // ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include "hpp/simple_arg_parser.hpp"
+#include "hpp/simple_arg_parser_edit_distance.hpp"
+#include "hpp/simple_arg_parser_bulk_conversion.hpp"
 
 namespace SimpleArgParser
 {
     Parser::Parser(std::initializer_list<Option> options_il, ParsingPolicy parsing_policy)
     :   options_(options_il)
-    ,   option_search_table_(2 * options_.size())
+    ,   option_search_table_(options_.size() + std::ranges::count_if(options_, [] (const Option& option) { return option.attributes_.alias_key.has_value(); }))
     ,   parsing_policy_(parsing_policy)
+    ,   specified_options_(options_.size())
+    ,   switch_states_(options_.size())
+    ,   required_options_(options_.size())
     {
+        dispatch_records_.reserve(options_.size());
+        initial_values_.reserve(options_.size());
+
         for (auto options_iter{options_.begin()}; options_iter != options_.end(); ++options_iter)
         {
-            options_iter->link_to_(this);
+            auto ordinal{static_cast<std::uint32_t>(options_iter - options_.begin())};
+
+            options_iter->link_to_(this, ordinal);
+
+            dispatch_records_.push_back({&*options_iter, this, ordinal, options_iter->is_switch_()});
+            initial_values_.push_back(options_iter->io_handler_->copy_value());
+
+            // The packed switch states are the source of truth, seeded from the initial switch values:
+            if (options_iter->is_switch_() && options_iter->switch_is_on_())
+                switch_states_.set(ordinal);
 
-            option_search_table_[options_iter->attributes_.key] = &*options_iter;
+            if (options_iter->is_bound_switch_())
+                bound_switch_ordinals_.push_back(ordinal);
+
+            option_search_table_.assign(options_iter->attributes_.key, ordinal);
+            has_numeric_keys_|=Internals_::is_plain_number(options_iter->attributes_.key);
+
+            if (options_iter->attributes_.environment_variable.has_value())
+                environment_search_table_[options_iter->attributes_.environment_variable.value()] = ordinal;
 
             if (options_iter->attributes_.alias_key.has_value())
             {
-                option_search_table_[options_iter->attributes_.alias_key.value()] = &*options_iter;
+                option_search_table_.assign(options_iter->attributes_.alias_key.value(), ordinal);
+                has_numeric_keys_|=Internals_::is_plain_number(options_iter->attributes_.alias_key.value());
             }
         }
+
+        // The keys are taken from the search table, so the duplicates are resolved the same way as there:
+        sorted_keys_.reserve(option_search_table_.size());
+
+        option_search_table_.for_each([this] (std::string_view option_key, std::uint32_t ordinal) { sorted_keys_.push_back({option_key, ordinal}); });
+
+        std::ranges::sort(sorted_keys_, {}, &SortedKey_::key);
     }
 
     const Option& Parser::operator[](std::string_view option_key) const
@@ -50,7 +82,60 @@ namespace SimpleArgParser
 
     bool Parser::has_option(std::string_view option_key) const
     {
-        return option_search_table_.contains(option_key);
+        return option_search_table_.contains(option_key) || (parent_parser_ && parent_parser_->has_option(option_key));
+    }
+
+    void Parser::set_key_suggestion_distance(std::size_t max_distance)
+    {
+        key_suggestion_distance_ = max_distance;
+    }
+
+    std::vector<std::string_view> Parser::complete_key(std::string_view prefix) const
+    {
+        auto matches{find_keys_with_prefix_(prefix)};
+        std::vector<std::string_view> option_keys;
+
+        option_keys.reserve(matches.size());
+
+        for (auto [option_key, ordinal] : matches)
+            option_keys.push_back(option_key);
+
+        return option_keys;
+    }
+
+    bool Parser::is_specified(std::string_view option_key) const
+    {
+        auto* option_ptr{get_option_(option_key)};
+
+        return option_ptr && option_ptr->is_specified();
+    }
+
+    bool Parser::switch_is_on(std::string_view option_key) const
+    {
+        auto* record{find_dispatch_record_(option_key)};
+
+        if (!record)
+            get_option_(option_key); // <-- throws if the parsing policy forbids undeclared options
+
+        if (!record || !record->is_switch)
+            throw OptionAccessException::AccessingValueTypeMismatch{std::source_location::current()};
+
+        return record->owner_ptr->switch_states_.test(record->ordinal);
+    }
+
+    void Parser::add_required_options(std::initializer_list<std::string_view> option_keys)
+    {
+        required_options_|=make_option_set_(option_keys);
+    }
+
+    void Parser::add_exclusive_group(std::initializer_list<std::string_view> option_keys)
+    {
+        exclusive_groups_.push_back(make_option_set_(option_keys));
+    }
+
+    void Parser::add_dependency(std::string_view dependent_option_key, std::initializer_list<std::string_view> prerequisite_option_keys)
+    {
+        dependencies_.push_back({get_ordinal_(dependent_option_key), make_option_set_(prerequisite_option_keys)});
     }
 
     int Parser::parse(int argc, const char* argv[])
@@ -62,85 +147,1302 @@ namespace SimpleArgParser
             Option::SubrangeOfArgV_ subrange_of_argv{argv + 1, argv + argc};
 
             std::size_t arg_parsed{0};
+            std::exception_ptr parsing_failure;
 
-            while (!subrange_of_argv.empty())
-            {
-                auto [option_key, option_ptr] = accept_next_option_(subrange_of_argv);
+            instrumentation_.record_parse();
+            sync_bound_switches_();
 
-                if (!option_ptr) continue;
+            selected_subcommand_ = {};
+            subcommand_parser_.reset();
+            specified_options_.clear();
+            deferred_inputs_.clear();
 
-                arg_parsed+=option_ptr->parse_option_argument_(subrange_of_argv);
+            try
+            {
+                arg_parsed = conversion_pool_ ? parse_in_parallel_(subrange_of_argv) : parse_serially_(subrange_of_argv);
+            }
+            catch (...)
+            {
+                parsing_failure = std::current_exception();
             }
 
+            // The deferred inputs are joined even if parsing failed, since they refer to the option values:
+            run_deferred_inputs_(parsing_failure);
+
+            if (parsing_failure)
+                std::rethrow_exception(parsing_failure);
+
+            check_option_constraints_();
+
             return arg_parsed; // <-- return the number of args consumed from subrange_of_argv, including option_key
         }
         catch (const OptionAccessException::UndeclaredOptionOrWrongOptionKey& oae)
         {
-            throw ParserException::ParsingPolicyViolation(oae.undefined_option_key, std::source_location::current());
+            throw ParserException::ParsingPolicyViolation(oae.undefined_option_key, suggest_option_keys_(oae.undefined_option_key), std::source_location::current());
+        }
+    }
+
+    void Parser::merge(std::span<const ConfigurationSource> sources)
+    {
+        struct ResolvedSpan
+        {
+            const DispatchRecord_*  record{nullptr};
+            std::string_view        option_key;
+            Option::SubrangeOfArgV_ value_span;     // The value tokens (or the attached value)
+            bool                    attached{false};    // The value is attached to the key with '='
+            bool                    switch_off{false};  // An environment value sets the switch off
+            std::size_t             source_index{0};
+        };
+
+        sync_bound_switches_();
+
+        instrumentation_.clear_trace_events();
+
+        try
+        {
+            std::vector<ResolvedSpan> resolved_spans(options_.size());  // The spans of highest precedence (by ordinals)
+            std::vector<const char*> attached_values;                   // The attached values referred by spans (never reallocated)
+
+            auto resolve = [this, &resolved_spans] (const ResolvedSpan& resolved_span)
+            {
+                // The options declared in the parent parser (if this one is a subcommand parser) are not merged:
+                if (resolved_span.record->owner_ptr == this)
+                    resolved_spans[resolved_span.record->ordinal] = resolved_span;
+            };
+
+            std::size_t token_count{0};
+
+            for (const auto& source : sources)
+                token_count+=source.tokens_.size();
+
+            attached_values.reserve(token_count);
+
+            // 1. Resolve the options to their value spans (a later source and a later occurrence in a source take precedence):
+            for (std::size_t source_index{0}; source_index < sources.size(); ++source_index)
+            {
+                const auto& source{sources[source_index]};
+
+                // The tokens are only read through the subranges:
+                auto tokens_begin{const_cast<const char**>(source.tokens_.data())};
+
+                if (source.is_environment_)
+                {
+                    for (const auto& [first_token, token_count] : source.entries_)
+                    {
+                        std::string_view option_key{tokens_begin[first_token]};
+                        Option::SubrangeOfArgV_ value_span{tokens_begin + first_token + 1, tokens_begin + first_token + token_count};
+
+                        auto* record{find_dispatch_record_(option_key)};
+
+                        if (!record) continue;
+
+                        bool switch_off{false};
+
+                        if (record->is_switch)
+                        {
+                            constexpr std::string_view SWITCH_OFF_VALUES[]{"0", "false", "off", "no"};
+
+                            // An empty value makes no tokens, so it's the empty span which stands for it. The span setting
+                            // the switch off is resolved as well, so it overrides the sources of lower precedence:
+                            switch_off = value_span.empty() || std::ranges::find(SWITCH_OFF_VALUES, *value_span.begin()) != std::end(SWITCH_OFF_VALUES);
+
+                            value_span = {value_span.begin(), value_span.begin()};
+                        }
+
+                        resolve({record, option_key, value_span, false, switch_off, source_index});
+                    }
+
+                    continue;
+                }
+
+                for (Option::SubrangeOfArgV_ subrange{tokens_begin, tokens_begin + source.tokens_.size()}; !subrange.empty();)
+                {
+                    auto accepted{accept_next_option_(subrange)};
+
+                    if (accepted.is_switch_cluster)
+                    {
+                        for (auto* record : switch_cluster_records_)
+                            resolve({record, record->option_ptr->get_key(), {}, false, false, source_index});
+
+                        continue;
+                    }
+
+                    if (!accepted.record) continue;
+
+                    if (accepted.attached_value)
+                    {
+                        auto* attached_value{&attached_values.emplace_back(accepted.attached_value)};
+
+                        resolve({accepted.record, accepted.option_key, {attached_value, attached_value + 1}, true, false, source_index});
+                    }
+                    else
+                    {
+                        auto value_span_size{accepted.record->option_ptr->count_value_span_(subrange)};
+
+                        resolve({accepted.record, accepted.option_key, {subrange.begin(), subrange.begin() + value_span_size}, false, false, source_index});
+
+                        subrange.advance(value_span_size);
+                    }
+                }
+            }
+
+            // 2. Convert each option value resolved once:
+            std::exception_ptr merging_failure;
+
+            specified_options_.clear();
+            deferred_inputs_.clear();
+            value_sources_.assign(options_.size(), 0);
+            merged_source_names_.clear();
+
+            for (const auto& source : sources)
+                merged_source_names_.push_back(source.name());
+
+            try
+            {
+                for (std::size_t ordinal{0}; ordinal < options_.size(); ++ordinal)
+                {
+                    auto& [record, option_key, value_span, attached, switch_off, source_index]{resolved_spans[ordinal]};
+
+                    if (!record) continue;
+
+                    parse_position_ = ordinal;
+
+                    if (record->is_switch)
+                    {
+                        // A switch takes no value, so the one attached to its key with '=' is never consumed:
+                        if (attached)
+                            throw OptionParsingException::AttachedValueNotConsumed{option_key, std::source_location::current()};
+
+                        // The switch set off is left Omitted (not specified), but its source is recorded:
+                        if (switch_off)
+                            set_switch_state_(*record, false);
+                        else
+                            set_switch_on_(*record);
+                    }
+                    else
+                    {
+                        parse_option_(*record, value_span);
+
+                        if (attached && !value_span.empty())
+                            throw OptionParsingException::AttachedValueNotConsumed{option_key, std::source_location::current()};
+                    }
+
+                    value_sources_[ordinal] = static_cast<std::uint32_t>(source_index + 1);
+                }
+            }
+            catch (...)
+            {
+                merging_failure = std::current_exception();
+            }
+
+            // The deferred inputs are joined even if merging failed, since they refer to the option values:
+            run_deferred_inputs_(merging_failure);
+
+            if (merging_failure)
+                std::rethrow_exception(merging_failure);
+
+            check_option_constraints_();
+        }
+        catch (const OptionAccessException::UndeclaredOptionOrWrongOptionKey& oae)
+        {
+            throw ParserException::ParsingPolicyViolation(oae.undefined_option_key, suggest_option_keys_(oae.undefined_option_key), std::source_location::current());
         }
     }
 
+    std::string_view Parser::value_source(std::string_view option_key) const
+    {
+        auto ordinal{get_ordinal_(option_key)};
+
+        if (ordinal >= value_sources_.size() || value_sources_[ordinal] == 0)
+            return {};
+
+        return merged_source_names_[value_sources_[ordinal] - 1];
+    }
+
+    void Parser::enable_parallel_conversion(std::size_t worker_count, std::size_t chunk_size)
+    {
+        conversion_pool_ = std::make_unique<Internals_::ThreadPool>(worker_count);
+        conversion_chunk_size_ = std::max(chunk_size, std::size_t{1});
+    }
+
+    void Parser::disable_parallel_conversion()
+    {
+        conversion_pool_.reset();
+        conversion_chunk_size_ = 0;
+    }
+
+    void Parser::set_async_input_concurrency(std::size_t async_input_concurrency)
+    {
+        async_input_concurrency_ = std::max(async_input_concurrency, std::size_t{1});
+    }
+
+    void Parser::add_subcommand(std::string_view subcommand, SubcommandParserFactory parser_factory)
+    {
+        subcommand_search_table_[subcommand] = std::move(parser_factory);
+        has_numeric_keys_|=Internals_::is_plain_number(subcommand);
+    }
+
+    std::string_view Parser::selected_subcommand() const
+    {
+        return selected_subcommand_;
+    }
+
+    Parser* Parser::selected_subcommand_parser()
+    {
+        return subcommand_parser_.get();
+    }
+
+    const Parser* Parser::selected_subcommand_parser() const
+    {
+        return subcommand_parser_.get();
+    }
+
     std::ostream& Parser::output(std::ostream& os) const
     {
         for (std::size_t option_count{options_.size()}; const auto& option : options_)
         {
-            if (option.has_value())
+            auto ordinal{options_.size() - option_count};
+
+            // A switch is output by its key if it's on:
+            if (dispatch_records_[ordinal].is_switch)
+                os << (output_switch_state_(ordinal) ? option.get_key() : std::string_view{}) << (--option_count ? " " : "");
+            else if (option.has_value())
                 os << option << (--option_count ? " " : "");
         }
 
         return os;
     }
 
+    void Parser::export_schema_index(std::ostream& os) const
+    {
+        std::vector<SchemaIndex::EntryRecord> records;
+        std::string strings;
+
+        auto add_string = [&strings] (std::string_view string) -> std::pair<std::uint32_t, std::uint32_t>
+        {
+            auto offset{strings.size()};
+
+            strings.append(string);
+
+            return {static_cast<std::uint32_t>(offset), static_cast<std::uint32_t>(string.size())};
+        };
+
+        for (const auto& option : options_)
+        {
+            auto [key_offset, key_size]{add_string(option.get_key())};
+            auto [description_offset, description_size]{add_string(option.attributes_.description.value_or(""))};
+            auto [item_token_count, max_items, is_vectored]{option.io_handler_->value_shape()};
+
+            SchemaIndex::EntryRecord record
+            {
+                key_offset
+            ,   key_size
+            ,   key_offset
+            ,   key_size
+            ,   description_offset
+            ,   description_size
+            ,   static_cast<std::uint16_t>(item_token_count)
+            ,   option.is_switch_() ? SchemaIndex::EntryKind::Switch : is_vectored ? SchemaIndex::EntryKind::Vectored : SchemaIndex::EntryKind::Scalar
+            };
+
+            records.push_back(record);
+
+            if (option.attributes_.alias_key.has_value())
+            {
+                std::tie(record.key_offset, record.key_size) = add_string(option.attributes_.alias_key.value());
+                records.push_back(record);
+            }
+        }
+
+        for (const auto& [subcommand, parser_factory] : subcommand_search_table_)
+        {
+            auto [key_offset, key_size]{add_string(subcommand)};
+
+            records.push_back({key_offset, key_size, key_offset, key_size, 0, 0, 0, SchemaIndex::EntryKind::Subcommand});
+        }
+
+        std::ranges::sort
+        (
+            records
+        ,   {}
+        ,   [&strings] (const SchemaIndex::EntryRecord& record) { return std::string_view{strings}.substr(record.key_offset, record.key_size); }
+        );
+
+        SchemaIndex::Header_ header{};
+
+        std::memcpy(header.magic, SchemaIndex::MAGIC, sizeof(SchemaIndex::MAGIC));
+        header.layout_version = SchemaIndex::LAYOUT_VERSION;
+        header.entry_count = records.size();
+        header.strings_offset = sizeof(header) + records.size() * sizeof(SchemaIndex::EntryRecord);
+        header.size = header.strings_offset + strings.size();
+
+        os.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        os.write(reinterpret_cast<const char*>(records.data()), records.size() * sizeof(SchemaIndex::EntryRecord));
+        os.write(strings.data(), strings.size());
+    }
+
+    Fingerprint Parser::fingerprint() const
+    {
+        FingerprintHasher hasher;
+
+        hash_options_(hasher);
+
+        return hasher.digest128();
+    }
+
+    void Parser::hash_options_(FingerprintHasher& hasher) const
+    {
+        for (std::uint32_t ordinal{0}; const auto& option : options_)
+        {
+            hasher.update_string(option.get_key());
+
+            if (option.is_switch_())
+                hasher.update_integer(static_cast<std::uint8_t>(output_switch_state_(ordinal)));
+            else
+                option.io_handler_->hash_value(hasher);
+
+            ++ordinal;
+        }
+
+        if (subcommand_parser_)
+        {
+            hasher.update_string(selected_subcommand_);
+            subcommand_parser_->hash_options_(hasher);
+        }
+    }
+
+    ArgumentVector Parser::make_argument_vector(std::string_view program_name) const
+    {
+        // Sizing pass:
+        Internals_::ArgumentStreamBuffer sizing_buffer;
+        std::ostream sizing_stream{&sizing_buffer};
+
+        sizing_stream << program_name << '\0';
+        output_arguments_(sizing_stream, sizing_buffer);
+
+        // Output pass (the argument pointers, including the terminating nullptr, are followed by the characters):
+        auto pointer_count{sizing_buffer.argument_count() + 1};
+        ArgumentVector argument_vector;
+
+        argument_vector.storage_.reset(new char*[pointer_count + (sizing_buffer.character_count() + sizeof(char*) - 1) / sizeof(char*)]);
+
+        Internals_::ArgumentStreamBuffer output_buffer{argument_vector.storage_.get(), reinterpret_cast<char*>(argument_vector.storage_.get() + pointer_count)};
+        std::ostream output_stream{&output_buffer};
+
+        output_stream << program_name << '\0';
+        output_arguments_(output_stream, output_buffer);
+
+        argument_vector.storage_[output_buffer.argument_count()] = nullptr;
+        argument_vector.argument_count_ = output_buffer.argument_count();
+
+        return argument_vector;
+    }
+
+    void Parser::output_arguments_(std::ostream& os, Internals_::ArgumentStreamBuffer& buffer) const
+    {
+        for (std::uint32_t ordinal{0}; const auto& option : options_)
+        {
+            if (option.is_switch_() ? output_switch_state_(ordinal) : specified_options_.test(ordinal))
+            {
+                os << option.get_key() << '\0';
+
+                buffer.set_item_token_count(option.io_handler_->value_shape().item_token_count);
+                option.io_handler_->output_value_items(os);
+                buffer.set_item_token_count(1);
+            }
+
+            ++ordinal;
+        }
+
+        if (subcommand_parser_)
+        {
+            os << selected_subcommand_ << '\0';
+            subcommand_parser_->output_arguments_(os, buffer);
+        }
+    }
+
     std::istream& Parser::input(std::istream& is)
     {
+        sync_bound_switches_();
+
         while (is)
         {
             std::string option_key;
 
             is >> option_key;
 
-            auto* option_ptr{get_option_(option_key)};
+            get_option_(option_key); // <-- throws if the option is undeclared and the parsing policy forbids it
+
+            auto* record{find_dispatch_record_(option_key)};
 
-            if (!option_ptr) continue;
+            if (!record) continue;
 
-            is >> *option_ptr;
+            // A switch is output by its key only, so the key input sets it on (and marks it specified, as parse() does):
+            if (record->is_switch)
+            {
+                set_switch_on_(*record);
+
+                continue;
+            }
+
+            is >> *record->option_ptr;
+
+            record->owner_ptr->specified_options_.set(record->ordinal);
         }
 
         return is;
     }
 
-
-    Option* Parser::get_option_(std::string_view option_key)
+    std::vector<std::string_view> Parser::reload(std::istream& is)
     {
-        try
+        sync_bound_switches_();
+
+        std::string text{std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>()};
+        std::vector<std::string> spans(options_.size());
+        Internals_::OptionBitSet present_options(options_.size());
+        std::string* span{nullptr};
+
+        // 1. Split the text into value spans of the options (the span of an option given twice is the last one, as input() takes it):
+        for (std::string_view rest{text}, token{Internals_::next_configuration_token(rest)}; !token.empty(); token = Internals_::next_configuration_token(rest))
         {
-            return option_search_table_.at(option_key);
+            if (auto ordinal{option_search_table_.find(token)}; ordinal != Internals_::FlatKeyTable::NOT_FOUND)
+            {
+                present_options.set(ordinal);
+
+                span = &spans[ordinal];
+                span->clear();
+            }
+            else if (span)
+            {
+                span->append(span->empty() ? "" : " ").append(token);
+            }
+            else
+            {
+                get_option_(token); // <-- throws if the parsing policy forbids undeclared options
+            }
         }
-        catch (const std::out_of_range& e)
+
+        // 2. Input the options whose spans are changed since the previous reload:
+        std::vector<std::size_t> changed_ordinals;
+
+        reload_spans_.resize(options_.size());
+
+        for (std::size_t ordinal{0}; ordinal < options_.size(); ++ordinal)
         {
-            if (parsing_policy_ == ParsingPolicy::ForbidUndeclaredOptions)
-                throw OptionAccessException::UndeclaredOptionOrWrongOptionKey{option_key, std::source_location::current()};
+            auto& option{options_[ordinal]};
+            const auto& previous_span{reload_spans_[ordinal]};
 
-            return nullptr;
+            if (!present_options.test(ordinal))
+            {
+                if (!previous_span)
+                    continue;
+
+                specified_options_.reset(ordinal);
+
+                if (dispatch_records_[ordinal].is_switch)
+                    set_switch_state_(dispatch_records_[ordinal], false);
+                else
+                    option.io_handler_->restore_value(initial_values_[ordinal]);
+            }
+            else
+            {
+                if (previous_span && *previous_span == spans[ordinal])
+                    continue;
+
+                if (dispatch_records_[ordinal].is_switch)
+                {
+                    set_switch_on_(dispatch_records_[ordinal]);
+                }
+                else
+                {
+                    std::istringstream span_stream{spans[ordinal]};
+
+                    span_stream >> option;
+
+                    specified_options_.set(ordinal);
+                }
+            }
+
+            changed_ordinals.push_back(ordinal);
+        }
+
+        // 3. Commit the spans only after all the options are input, so if an inputter throws, the options input before
+        // it are compared with their old spans and reported as changed once again by the next reload:
+        std::vector<std::string_view> changed_keys;
+
+        changed_keys.reserve(changed_ordinals.size());
+
+        for (auto ordinal : changed_ordinals)
+        {
+            if (present_options.test(ordinal))
+                reload_spans_[ordinal] = std::move(spans[ordinal]);
+            else
+                reload_spans_[ordinal].reset();
+
+            changed_keys.push_back(options_[ordinal].get_key());
         }
+
+        return changed_keys;
     }
 
-    const Option* Parser::get_option_(std::string_view option_key) const
+
+    ParserStatistics Parser::statistics() const
     {
-        return const_cast<Parser*>(this)->get_option_(option_key);
+        return instrumentation_.statistics();
     }
 
-    std::tuple<std::string_view, Option*> Parser::accept_next_option_(Option::SubrangeOfArgV_& subrange_of_argv)
+    std::ostream& Parser::output_trace_events(std::ostream& os) const
     {
-        if (subrange_of_argv.empty()) return { "", nullptr };
+        return instrumentation_.output_trace_events(os);
+    }
 
-        std::string_view option_key{*subrange_of_argv.begin()};
+    void Parser::reset_statistics()
+    {
+        instrumentation_.reset();
 
-        auto* option_ptr{get_option_(option_key)};
+        for (auto& option : options_)
+            option.instrumentation_.reset();
+    }
 
-        subrange_of_argv.advance(1);
 
-        return {option_key, option_ptr};
+    MemoryFootprint Parser::memory_footprint() const
+    {
+        // Estimation of a node of std::unordered_map: the value and the pointer to the next node (plus cached hash):
+        constexpr auto SEARCH_TABLE_NODE_BYTES{sizeof(OptionSearchTable::value_type) + 2 * sizeof(void*)};
+        constexpr auto SUBCOMMAND_TABLE_NODE_BYTES{sizeof(SubcommandSearchTable::value_type) + 2 * sizeof(void*)};
+
+        // All the option sets have the same size (the number of options):
+        constexpr auto WORD_BITS{Internals_::OptionBitSet::WORD_BITS};
+        auto option_set_bytes{(options_.size() + WORD_BITS - 1) / WORD_BITS * sizeof(Internals_::OptionBitSet::Word)};
+
+        MemoryFootprint footprint{options_.size()};
+
+        footprint.hot_bytes =
+            dispatch_records_.capacity() * sizeof(DispatchRecord_)
+        +   option_search_table_.bytes()
+        +   2 * option_set_bytes // <-- specified options and switch states
+        ;
+
+        footprint.cold_bytes =
+            sizeof(Parser)
+        +   options_.capacity() * sizeof(Option)
+        +   subcommand_search_table_.bucket_count() * sizeof(void*)
+        +   subcommand_search_table_.size() * SUBCOMMAND_TABLE_NODE_BYTES
+        +   sorted_keys_.capacity() * sizeof(SortedKey_)
+        +   environment_search_table_.bucket_count() * sizeof(void*)
+        +   environment_search_table_.size() * SEARCH_TABLE_NODE_BYTES
+        +   initial_values_.capacity() * sizeof(std::any)
+        +   option_set_bytes // <-- required options
+        +   exclusive_groups_.size() * (sizeof(Internals_::OptionBitSet) + option_set_bytes)
+        +   dependencies_.size() * (sizeof(OptionDependency_) + option_set_bytes)
+        ;
+
+        return footprint;
+    }
+
+
+    void Parser::publish_snapshot()
+    {
+        auto snapshot{std::make_unique<OptionSnapshot>()};
+
+        snapshot->parser_ptr_ = this;
+        snapshot->version_ = ++snapshot_version_;
+        snapshot->specified_options_ = specified_options_;
+        snapshot->values_.reserve(options_.size());
+
+        for (std::size_t ordinal{0}; auto& option : options_)
+        {
+            if (option.is_switch_())
+                snapshot->values_.emplace_back(output_switch_state_(ordinal) ? SwitchState::Specified : SwitchState::Omitted);
+            else
+                snapshot->values_.push_back(option.io_handler_->copy_value());
+
+            ++ordinal;
+        }
+
+        snapshot_cell_.publish(std::move(snapshot));
+    }
+
+    SnapshotReadGuard Parser::acquire_snapshot() const
+    {
+        return snapshot_cell_.acquire();
+    }
+
+    bool OptionSnapshot::is_specified(std::string_view option_key) const
+    {
+        return specified_options_.test(get_ordinal_(option_key));
+    }
+
+    std::size_t OptionSnapshot::get_ordinal_(std::string_view option_key) const
+    {
+        return parser_ptr_->get_ordinal_(option_key);
+    }
+
+
+    Option* Parser::get_option_(std::string_view option_key)
+    {
+        // Note: no exceptions are thrown (and so no allocations are done) for undeclared options skipped by policy
+        if (auto* option_ptr{find_option_(option_key)}; option_ptr)
+            return option_ptr;
+
+        if (has_flag(parsing_policy_, ParsingPolicy::ForbidUndeclaredOptions))
+            throw OptionAccessException::UndeclaredOptionOrWrongOptionKey{option_key, std::source_location::current()};
+
+        return nullptr;
+    }
+
+    const Option* Parser::get_option_(std::string_view option_key) const
+    {
+        return const_cast<Parser*>(this)->get_option_(option_key);
+    }
+
+    const Parser::DispatchRecord_* Parser::find_dispatch_record_(std::string_view option_key) const
+    {
+        if (auto ordinal{option_search_table_.find(option_key)}; ordinal != Internals_::FlatKeyTable::NOT_FOUND)
+            return &dispatch_records_[ordinal];
+
+        return parent_parser_ ? parent_parser_->find_dispatch_record_(option_key) : nullptr;
+    }
+
+    const Option* Parser::find_bound_option_(std::string_view variable_name, bool& is_single_token) const
+    {
+        auto found{environment_search_table_.find(variable_name)};
+
+        if (found == environment_search_table_.end())
+            return nullptr;
+
+        const auto& option{options_[found->second]};
+        auto [item_token_count, max_items, is_vectored]{option.io_handler_->value_shape()};
+
+        is_single_token = !is_vectored && item_token_count == 1;
+
+        return &option;
+    }
+
+    std::span<const Parser::SortedKey_> Parser::find_keys_with_prefix_(std::string_view prefix) const
+    {
+        auto range_begin{std::ranges::lower_bound(sorted_keys_, prefix, {}, &SortedKey_::key)};
+        auto range_end{std::partition_point(range_begin, sorted_keys_.end(), [prefix] (const SortedKey_& sorted_key) { return sorted_key.key.starts_with(prefix); })};
+
+        return {range_begin, range_end};
+    }
+
+    const Parser::DispatchRecord_* Parser::find_abbreviated_record_(std::string_view abbreviation) const
+    {
+        // Short keys (like -v) are never abbreviated, and "--" alone is not taken for an abbreviation of every long key:
+        if (!has_flag(parsing_policy_, ParsingPolicy::AcceptKeyAbbreviations) || abbreviation.size() < 3 || !abbreviation.starts_with("--"))
+            return nullptr;
+
+        for (auto* parser{this}; parser; parser = parser->parent_parser_)
+        {
+            auto matches{parser->find_keys_with_prefix_(abbreviation)};
+
+            if (matches.empty())
+                continue;
+
+            // The key and the alias of the same option may both match:
+            auto ordinal{matches.front().ordinal};
+
+            if (std::ranges::all_of(matches, [ordinal] (const SortedKey_& match) { return match.ordinal == ordinal; }))
+                return &parser->dispatch_records_[ordinal];
+
+            std::string candidate_keys;
+
+            for (auto [option_key, match_ordinal] : matches)
+                candidate_keys+=std::format("{}'{}'", candidate_keys.empty() ? "" : ", ", option_key);
+
+            throw ParserException::AmbiguousOptionKeyAbbreviation(abbreviation, candidate_keys, std::source_location::current());
+        }
+
+        return nullptr;
+    }
+
+    std::vector<std::string> Parser::suggest_option_keys_(std::string_view undeclared_option_key) const
+    {
+        Internals_::BoundedEditDistance edit_distance{undeclared_option_key, std::min(key_suggestion_distance_, undeclared_option_key.size() / 3)};
+        std::vector<std::pair<std::size_t, std::string_view>> candidates; // <-- distances and keys
+
+        for (auto* parser{this}; parser; parser = parser->parent_parser_)
+        {
+            for (auto [option_key, ordinal] : parser->sorted_keys_)
+            {
+                if (auto distance{edit_distance(option_key)})
+                    candidates.emplace_back(*distance, option_key);
+            }
+        }
+
+        // The keys of a subcommand parser may shadow the ones of its parent parsers:
+        std::ranges::sort(candidates);
+        candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+
+        std::vector<std::string> suggestions;
+
+        auto suggestion_count{std::min(candidates.size(), MAX_KEY_SUGGESTIONS)};
+
+        suggestions.reserve(suggestion_count);
+
+        for (std::size_t candidate_index{0}; candidate_index < suggestion_count; ++candidate_index)
+            suggestions.emplace_back(candidates[candidate_index].second);
+
+        return suggestions;
+    }
+
+    Option* Parser::find_option_(std::string_view option_key)
+    {
+        auto* record{find_dispatch_record_(option_key)};
+
+        return record ? record->option_ptr : nullptr;
+    }
+
+    bool Parser::terminates_option_value_(std::string_view arg) const
+    {
+        // Plain numbers (typical vectored option value items) are not looked up, unless there are keys looking like them:
+        if (!numeric_keys_declared_() && Internals_::is_plain_number(arg))
+            return false;
+
+        if (has_option(arg) || subcommand_search_table_.contains(arg))
+            return true;
+
+        // The string scans of key-value arguments, switch clusters and key abbreviations run for the policies enabling them only:
+        constexpr auto ARGUMENT_FORM_FLAGS{ParsingPolicy::SplitKeyValueArguments | ParsingPolicy::ClusterShortSwitches | ParsingPolicy::AcceptKeyAbbreviations};
+
+        if (!has_flag(parsing_policy_, ARGUMENT_FORM_FLAGS))
+            return false;
+
+        const DispatchRecord_* record{nullptr};
+
+        return
+            (has_flag(parsing_policy_, ParsingPolicy::SplitKeyValueArguments) && find_attached_value_(arg, record))
+        ||  (has_flag(parsing_policy_, ParsingPolicy::ClusterShortSwitches) && is_switch_cluster_(arg))
+        ||  (has_flag(parsing_policy_, ParsingPolicy::AcceptKeyAbbreviations) && find_abbreviated_record_(arg))
+        ;
+    }
+
+    bool Parser::numeric_keys_declared_() const
+    {
+        return has_numeric_keys_ || (parent_parser_ && parent_parser_->numeric_keys_declared_());
+    }
+
+    int Parser::parse_serially_(Option::SubrangeOfArgV_& subrange_of_argv)
+    {
+        std::size_t arg_parsed{0};
+
+        for (auto argv_begin{subrange_of_argv.begin()}; !subrange_of_argv.empty();)
+        {
+            parse_position_ = subrange_of_argv.begin() - argv_begin;
+
+            if (!subcommand_search_table_.empty() && !has_option(*subrange_of_argv.begin()))
+            {
+                if (std::string_view subcommand{*subrange_of_argv.begin()}; subcommand_search_table_.contains(subcommand))
+                {
+                    arg_parsed+=parse_subcommand_(subcommand, subrange_of_argv);
+
+                    break;
+                }
+            }
+
+            Internals_::Stopwatch lookup_stopwatch;
+
+            auto accepted{accept_next_option_(subrange_of_argv)};
+
+            instrumentation_.record_lookup(accepted.record ? accepted.record->option_ptr->get_key() : std::string_view{}, lookup_stopwatch);
+
+            if (accepted.is_switch_cluster)
+            {
+                arg_parsed+=parse_switch_cluster_();
+
+                continue;
+            }
+
+            if (!accepted.record) continue;
+
+            if (accepted.record->is_switch)
+            {
+                // A switch takes no value, so the one attached to its key with '=' is never consumed:
+                if (accepted.attached_value)
+                    throw OptionParsingException::AttachedValueNotConsumed{accepted.option_key, std::source_location::current()};
+
+                set_switch_on_(*accepted.record);
+
+                ++arg_parsed;
+
+                continue;
+            }
+
+            if (accepted.attached_value)
+            {
+                // The value attached with '=' is parsed from its own single argument subrange:
+                Option::SubrangeOfArgV_ attached_subrange{&accepted.attached_value, &accepted.attached_value + 1};
+
+                arg_parsed+=parse_option_(*accepted.record, attached_subrange) - 1;
+
+                if (!attached_subrange.empty())
+                    throw OptionParsingException::AttachedValueNotConsumed{accepted.option_key, std::source_location::current()};
+            }
+            else
+            {
+                arg_parsed+=parse_option_(*accepted.record, subrange_of_argv);
+            }
+        }
+
+        return arg_parsed;
+    }
+
+    int Parser::parse_in_parallel_(Option::SubrangeOfArgV_& subrange_of_argv)
+    {
+        constexpr auto NO_POSITION{std::numeric_limits<std::size_t>::max()};
+
+        struct ConversionJob
+        {
+            const DispatchRecord_*  record;
+            std::string_view        option_key;
+            Option::SubrangeOfArgV_ value_span;     // The value arguments (or the attached value)
+            std::size_t             position;       // Position of the option key in argv (errors are ordered by it)
+            bool                    attached;       // The value is attached to the key with '='
+            int                     args_parsed{0};
+            Internals_::ParserInstrumentation::Conversion conversion{}; // Recorded after the conversions (from the calling thread)
+        };
+
+        struct ParsingError
+        {
+            std::size_t         position{NO_POSITION};
+            std::exception_ptr  exception;
+        };
+
+        std::vector<ConversionJob> jobs;
+        std::vector<const char*> attached_values;  // The attached values referred by value spans (never reallocated)
+        std::size_t arg_parsed{0}, position{0};
+        std::string_view subcommand;
+        ParsingError first_error;
+
+        attached_values.reserve(subrange_of_argv.size());
+
+        auto argv_begin{subrange_of_argv.begin()};
+
+        // 1. Scan the arguments serially: accept the option keys, set the switches on and take the value spans of the rest:
+        try
+        {
+            while (!subrange_of_argv.empty())
+            {
+                position = subrange_of_argv.begin() - argv_begin;
+
+                if (!subcommand_search_table_.empty() && !has_option(*subrange_of_argv.begin()))
+                {
+                    // The subcommand is parsed after conversions, since it ends the arguments of this parser:
+                    if (subcommand = *subrange_of_argv.begin(); subcommand_search_table_.contains(subcommand))
+                        break;
+
+                    subcommand = {};
+                }
+
+                Internals_::Stopwatch lookup_stopwatch;
+
+                auto accepted{accept_next_option_(subrange_of_argv)};
+
+                instrumentation_.record_lookup(accepted.record ? accepted.record->option_ptr->get_key() : std::string_view{}, lookup_stopwatch);
+
+                if (accepted.is_switch_cluster)
+                {
+                    arg_parsed+=parse_switch_cluster_();
+
+                    continue;
+                }
+
+                if (!accepted.record) continue;
+
+                if (accepted.record->is_switch)
+                {
+                    if (accepted.attached_value)
+                        throw OptionParsingException::AttachedValueNotConsumed{accepted.option_key, std::source_location::current()};
+
+                    set_switch_on_(*accepted.record);
+
+                    ++arg_parsed;
+
+                    continue;
+                }
+
+                if (accepted.attached_value)
+                {
+                    auto* attached_value{&attached_values.emplace_back(accepted.attached_value)};
+
+                    jobs.push_back({accepted.record, accepted.option_key, {attached_value, attached_value + 1}, position, true});
+                }
+                else
+                {
+                    auto value_span_size{accepted.record->option_ptr->count_value_span_(subrange_of_argv)};
+
+                    jobs.push_back({accepted.record, accepted.option_key, {subrange_of_argv.begin(), subrange_of_argv.begin() + value_span_size}, position, false});
+
+                    subrange_of_argv.advance(value_span_size);
+                }
+            }
+        }
+        catch (...)
+        {
+            first_error = {position, std::current_exception()};
+        }
+
+        // 2. Convert the values of different options concurrently (the occurrences of the same option are converted in order):
+        std::ranges::stable_sort(jobs, std::less{}, [] (const ConversionJob& job) { return job.record->option_ptr; });
+
+        std::vector<std::size_t> group_starts;
+
+        for (std::size_t job_index{0}; job_index < jobs.size(); ++job_index)
+            if (job_index == 0 || jobs[job_index].record->option_ptr != jobs[job_index - 1].record->option_ptr) group_starts.push_back(job_index);
+
+        std::vector<ParsingError> group_errors(group_starts.size());
+
+        group_starts.push_back(jobs.size());
+
+        conversion_pool_->run
+        (
+            group_errors.size()
+        ,   [&] (std::size_t group_index)
+            {
+                for (auto job_index{group_starts[group_index]}; job_index < group_starts[group_index + 1]; ++job_index)
+                {
+                    auto& job{jobs[job_index]};
+
+                    try
+                    {
+                        auto& option{*job.record->option_ptr};
+                        auto conversion_mark{instrumentation_.start_conversion(option.instrumentation_)};
+
+                        option.argument_position_ = job.position;
+                        job.args_parsed = option.parse_option_argument_(job.value_span);
+                        job.conversion = instrumentation_.measure_conversion(option.instrumentation_, conversion_mark);
+
+                        if (job.attached && !job.value_span.empty())
+                            throw OptionParsingException::AttachedValueNotConsumed{job.option_key, std::source_location::current()};
+                    }
+                    catch (...)
+                    {
+                        group_errors[group_index] = {job.position, std::current_exception()};
+
+                        return;
+                    }
+                }
+            }
+        );
+
+        // 3. Raise the error that serial parsing would raise (the one met at the first position in argv):
+        for (const auto& group_error : group_errors)
+            if (group_error.exception && group_error.position < first_error.position) first_error = group_error;
+
+        if (first_error.exception)
+        {
+            parse_position_ = first_error.position;
+
+            std::rethrow_exception(first_error.exception);
+        }
+
+        for (const auto& job : jobs)
+        {
+            instrumentation_.record_conversion(job.record->option_ptr->get_key(), job.conversion);
+
+            // The option may be declared in the parent parser (if this one is a subcommand parser), so it's marked there:
+            job.record->owner_ptr->specified_options_.set(job.record->ordinal);
+
+            arg_parsed+=job.args_parsed - (job.attached ? 1 : 0);
+        }
+
+        if (!subcommand.empty())
+        {
+            parse_position_ = subrange_of_argv.begin() - argv_begin;
+            arg_parsed+=parse_subcommand_(subcommand, subrange_of_argv);
+        }
+
+        return arg_parsed;
+    }
+
+    void Parser::defer_input_(const Option* option_ptr, std::size_t position, std::function<std::optional<std::string>()>&& input)
+    {
+        std::lock_guard lock{deferred_inputs_mutex_};
+
+        deferred_inputs_.push_back({option_ptr, position, std::move(input)});
+    }
+
+    void Parser::discard_deferred_inputs_(const Option* option_ptr)
+    {
+        std::lock_guard lock{deferred_inputs_mutex_};
+
+        std::erase_if(deferred_inputs_, [option_ptr] (const DeferredInput_& deferred_input) { return deferred_input.option_ptr == option_ptr; });
+    }
+
+    void Parser::run_deferred_inputs_(std::exception_ptr& parsing_failure)
+    {
+        if (deferred_inputs_.empty())
+            return;
+
+        std::vector<std::exception_ptr> input_failures(deferred_inputs_.size());
+
+        auto run_input = [this, &input_failures] (std::size_t input_index)
+        {
+            try
+            {
+                if (auto failure_message{deferred_inputs_[input_index].input()}; failure_message)
+                    throw OptionIOException::ValueInputterFailure(*failure_message, std::source_location::current());
+            }
+            catch (...)
+            {
+                input_failures[input_index] = std::current_exception();
+            }
+        };
+
+        // The calling thread runs the inputs too, so the pool has one worker less than the concurrency:
+        if (auto worker_count{std::min(async_input_concurrency_, deferred_inputs_.size()) - 1}; worker_count > 0)
+        {
+            Internals_::ThreadPool{worker_count}.run(deferred_inputs_.size(), run_input);
+        }
+        else
+        {
+            for (std::size_t input_index{0}; input_index < deferred_inputs_.size(); ++input_index)
+                run_input(input_index);
+        }
+
+        // The inputs of the same option are deferred in argv order, so the first failure at the minimal position is the first one:
+        std::size_t first_failure_position{0};
+        std::exception_ptr first_input_failure;
+
+        for (std::size_t input_index{0}; input_index < deferred_inputs_.size(); ++input_index)
+        {
+            if (input_failures[input_index] && (!first_input_failure || deferred_inputs_[input_index].position < first_failure_position))
+            {
+                first_failure_position = deferred_inputs_[input_index].position;
+                first_input_failure = input_failures[input_index];
+            }
+        }
+
+        deferred_inputs_.clear();
+
+        // The input failed before the parsing failure position (or at it) is reported, since serial input would fail first:
+        if (first_input_failure && (!parsing_failure || first_failure_position <= parse_position_))
+            parsing_failure = first_input_failure;
+    }
+
+    int Parser::parse_subcommand_(std::string_view subcommand, Option::SubrangeOfArgV_& subrange_of_argv)
+    {
+        subcommand_parser_ = subcommand_search_table_.at(subcommand)();
+
+        if (!subcommand_parser_)
+            throw ParserException::SubcommandParserConstructionFailure(subcommand, std::source_location::current());
+
+        selected_subcommand_ = subcommand;
+        subcommand_parser_->parent_parser_ = this;
+
+        // The subcommand name is passed to the subcommand parser as its argv[0]:
+        auto args_parsed{subcommand_parser_->parse(static_cast<int>(subrange_of_argv.size()), subrange_of_argv.begin())};
+
+        subrange_of_argv.advance(subrange_of_argv.size());
+
+        return args_parsed + 1;
+    }
+
+    Parser::AcceptedArgument_ Parser::accept_next_option_(Option::SubrangeOfArgV_& subrange_of_argv)
+    {
+        if (subrange_of_argv.empty()) return {};
+
+        std::string_view arg{*subrange_of_argv.begin()};
+
+        subrange_of_argv.advance(1);
+
+        // The argument like --key=value is split before the first lookup, so its key is looked up once:
+        auto delimiter_pos{has_flag(parsing_policy_, ParsingPolicy::SplitKeyValueArguments) ? arg.find('=') : std::string_view::npos};
+
+        if (delimiter_pos == 0)
+            delimiter_pos = std::string_view::npos;
+
+        if (delimiter_pos != std::string_view::npos)
+        {
+            if (auto* record{find_dispatch_record_(arg.substr(0, delimiter_pos))}; record)
+                return {arg.substr(0, delimiter_pos), record, arg.data() + delimiter_pos + 1};
+        }
+
+        if (auto* record{find_dispatch_record_(arg)}; record)
+            return {arg, record};
+
+        // Slower paths are taken for undeclared keys only:
+        if (delimiter_pos != std::string_view::npos)
+        {
+            if (auto* record{find_abbreviated_record_(arg.substr(0, delimiter_pos))}; record)
+                return {arg.substr(0, delimiter_pos), record, arg.data() + delimiter_pos + 1};
+        }
+
+        if (is_switch_cluster_(arg, &switch_cluster_records_))
+            return {arg, nullptr, nullptr, true};
+
+        // The option abbreviated is accepted by its full key (so it's reported and instrumented by it):
+        if (auto* record{find_abbreviated_record_(arg)}; record)
+            return {record->option_ptr->get_key(), record};
+
+        get_option_(arg); // <-- throws if the parsing policy forbids undeclared options
+
+        return {arg};
+    }
+
+    int Parser::parse_option_(const DispatchRecord_& record, Option::SubrangeOfArgV_& subrange_of_argv)
+    {
+        auto& option{*record.option_ptr};
+        auto conversion_mark{instrumentation_.start_conversion(option.instrumentation_)};
+
+        option.argument_position_ = parse_position_;
+
+        auto args_parsed{option.parse_option_argument_(subrange_of_argv)};
+
+        instrumentation_.record_conversion(option.get_key(), option.instrumentation_, conversion_mark);
+
+        // The option may be declared in the parent parser (if this one is a subcommand parser), so it's marked there:
+        record.owner_ptr->specified_options_.set(record.ordinal);
+
+        return args_parsed;
+    }
+
+    int Parser::parse_switch_cluster_()
+    {
+        // The records of the switches are resolved by accept_next_option_():
+        for (auto* record : switch_cluster_records_)
+            set_switch_on_(*record);
+
+        return 1;
+    }
+
+    void Parser::set_switch_on_(const DispatchRecord_& record)
+    {
+        // The switch may be declared in the parent parser (if this one is a subcommand parser), so it's set there:
+        auto& owner{*record.owner_ptr};
+        auto& option{*record.option_ptr};
+        auto conversion_mark{instrumentation_.start_conversion(option.instrumentation_)};
+        Internals_::Stopwatch stopwatch;
+
+        owner.specified_options_.set(record.ordinal);
+
+        set_switch_state_(record, true);
+
+        option.instrumentation_.record_conversion(0, stopwatch);
+        option.instrumentation_.record_items(1, 0, 0);
+
+        instrumentation_.record_conversion(option.get_key(), option.instrumentation_, conversion_mark);
+    }
+
+    void Parser::set_switch_state_(const DispatchRecord_& record, bool is_on)
+    {
+        auto& owner{*record.owner_ptr};
+
+        if (is_on)
+            owner.switch_states_.set(record.ordinal);
+        else
+            owner.switch_states_.reset(record.ordinal);
+
+        record.option_ptr->get_value_<SwitchState>() = is_on ? SwitchState::Specified : SwitchState::Omitted;
+    }
+
+    void Parser::sync_bound_switches_()
+    {
+        for (auto ordinal : bound_switch_ordinals_)
+        {
+            if (options_[ordinal].switch_is_on_())
+                switch_states_.set(ordinal);
+            else
+                switch_states_.reset(ordinal);
+        }
+    }
+
+    bool Parser::output_switch_state_(std::size_t ordinal) const
+    {
+        const auto& option{options_[ordinal]};
+
+        return option.is_bound_switch_() ? option.switch_is_on_() : switch_states_.test(ordinal);
+    }
+
+    const char* Parser::find_attached_value_(std::string_view arg, const DispatchRecord_*& record) const
+    {
+        if (!has_flag(parsing_policy_, ParsingPolicy::SplitKeyValueArguments))
+            return nullptr;
+
+        auto delimiter_pos{arg.find('=')};
+
+        if (delimiter_pos == std::string_view::npos || delimiter_pos == 0)
+            return nullptr;
+
+        auto option_key{arg.substr(0, delimiter_pos)};
+
+        record = find_dispatch_record_(option_key);
+
+        if (!record)
+            record = find_abbreviated_record_(option_key);
+
+        return record ? arg.data() + delimiter_pos + 1 : nullptr;
+    }
+
+    bool Parser::is_switch_cluster_(std::string_view arg, std::vector<const DispatchRecord_*>* records) const
+    {
+        if (!has_flag(parsing_policy_, ParsingPolicy::ClusterShortSwitches) || arg.size() < 3 || arg[0] != '-' || arg[1] == '-')
+            return false;
+
+        if (records)
+            records->clear();
+
+        for (auto switch_char : arg.substr(1))
+        {
+            const char switch_key[]{'-', switch_char};
+
+            auto* record{find_dispatch_record_({switch_key, 2})};
+
+            if (!record || !record->is_switch)
+                return false;
+
+            if (records)
+                records->push_back(record);
+        }
+
+        return true;
+    }
+
+    Internals_::OptionBitSet Parser::make_option_set_(std::initializer_list<std::string_view> option_keys) const
+    {
+        Internals_::OptionBitSet option_set(options_.size());
+
+        for (auto option_key : option_keys)
+            option_set.set(get_ordinal_(option_key));
+
+        return option_set;
+    }
+
+    std::size_t Parser::get_ordinal_(std::string_view option_key) const
+    {
+        auto ordinal{option_search_table_.find(option_key)};
+
+        if (ordinal == Internals_::FlatKeyTable::NOT_FOUND)
+            throw OptionAccessException::UndeclaredOptionOrWrongOptionKey{option_key, std::source_location::current()};
+
+        return ordinal;
+    }
+
+    void Parser::check_option_constraints_() const
+    {
+        if (auto missing{required_options_.find_first_missing_in(specified_options_)}; missing != required_options_.NPOS)
+            throw ParserException::RequiredOptionMissing(options_[missing].get_key(), std::source_location::current());
+
+        for (const auto& exclusive_group : exclusive_groups_)
+        {
+            if (exclusive_group.intersection_count(specified_options_) > 1)
+            {
+                auto first{exclusive_group.find_next_common_with(specified_options_)};
+                auto second{exclusive_group.find_next_common_with(specified_options_, first + 1)};
+
+                throw ParserException::ExclusiveOptionsSpecified(options_[first].get_key(), options_[second].get_key(), std::source_location::current());
+            }
+        }
+
+        for (const auto& [dependent_ordinal, prerequisites] : dependencies_)
+        {
+            if (!specified_options_.test(dependent_ordinal))
+                continue;
+
+            if (auto missing{prerequisites.find_first_missing_in(specified_options_)}; missing != prerequisites.NPOS)
+                throw ParserException::OptionDependencyViolation(options_[dependent_ordinal].get_key(), options_[missing].get_key(), std::source_location::current());
+        }
     }
 
     std::ostream& operator<<(std::ostream& os, const Parser& parser)
@@ -15,23 +15,45 @@ VERSION = 1.0.0
 
 SOURCES += \
     simple_arg_parser.cpp \
-    simple_arg_parser_option.cpp
+    simple_arg_parser_argument_vector.cpp \
+    simple_arg_parser_configuration_source.cpp \
+    simple_arg_parser_edit_distance.cpp \
+    simple_arg_parser_fingerprint.cpp \
+    simple_arg_parser_option.cpp \
+    simple_arg_parser_schema_index.cpp \
+    simple_arg_parser_shared_configuration.cpp \
+    simple_arg_parser_thread_pool.cpp
 
 HEADERS += \
     hpp/simple_arg_parser.hpp \
+    hpp/simple_arg_parser_argument_vector.hpp \
     hpp/simple_arg_parser_auxiliaries.hpp \
+    hpp/simple_arg_parser_bulk_conversion.hpp \
     hpp/simple_arg_parser_compiler_fine_tunes.hpp \
+    hpp/simple_arg_parser_configuration_source.hpp \
+    hpp/simple_arg_parser_edit_distance.hpp \
+    hpp/simple_arg_parser_enum_value_traits.hpp \
     hpp/simple_arg_parser_exceptions.hpp \
+    hpp/simple_arg_parser_fingerprint.hpp \
+    hpp/simple_arg_parser_flat_key_table.hpp \
+    hpp/simple_arg_parser_inplace_vector.hpp \
+    hpp/simple_arg_parser_instrumentation.hpp \
     hpp/simple_arg_parser_iostream_handlers.hpp \
     hpp/simple_arg_parser_option.hpp \
+    hpp/simple_arg_parser_option_bitset.hpp \
+    hpp/simple_arg_parser_rcu.hpp \
     hpp/simple_arg_parser_scalar_value.hpp \
+    hpp/simple_arg_parser_schema_index.hpp \
+    hpp/simple_arg_parser_shared_configuration.hpp \
     hpp/simple_arg_parser_spec_value_traits.hpp \
     hpp/simple_arg_parser_switch_state.hpp \
+    hpp/simple_arg_parser_thread_pool.hpp \
     hpp/simple_arg_parser_vectored_value.hpp
 
 # Default rules for deployment.
 unix {
     target.path = /usr/lib
+    LIBS += -lrt    # shm_open and shm_unlink (SharedConfiguration)
 }
 !isEmpty(target.path): INSTALLS += target
 
@@ -0,0 +1,80 @@
+// Copyright 2025 arkanarian-a
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is furnished
+// to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include <cctype>
+#include "hpp/simple_arg_parser_argument_vector.hpp"
+
+namespace SimpleArgParser::Internals_
+{
+    ArgumentStreamBuffer::int_type ArgumentStreamBuffer::overflow(int_type c)
+    {
+        if (!traits_type::eq_int_type(c, traits_type::eof()))
+            put_(traits_type::to_char_type(c));
+
+        return traits_type::not_eof(c);
+    }
+
+    std::streamsize ArgumentStreamBuffer::xsputn(const char* s, std::streamsize count)
+    {
+        for (std::streamsize char_index{0}; char_index < count; ++char_index)
+            put_(s[char_index]);
+
+        return count;
+    }
+
+    void ArgumentStreamBuffer::put_(char c)
+    {
+        bool ends_token{c == '\0'};
+
+        if (!ends_token && item_tokens_ended_ + 1 < item_token_count_)
+        {
+            if (quote_mark_ ? c == quote_mark_ : (c == '"' || c == '\''))
+                quote_mark_ = quote_mark_ ? '\0' : c;
+            else if (!quote_mark_ && std::isspace(static_cast<unsigned char>(c)))
+                ends_token = true;
+        }
+
+        if (characters_)
+            characters_[character_count_] = ends_token ? '\0' : c;
+
+        ++character_count_;
+
+        if (!ends_token)
+            return;
+
+        // The spaces between the tokens of an item make no empty arguments:
+        if (c == '\0' || character_count_ - 1 > argument_begin_)
+        {
+            if (arguments_)
+                arguments_[argument_count_] = characters_ + argument_begin_;
+
+            ++argument_count_;
+
+            if (c != '\0')
+                ++item_tokens_ended_;
+        }
+
+        if (c == '\0')
+        {
+            item_tokens_ended_ = 0;
+            quote_mark_ = '\0';
+        }
+
+        argument_begin_ = character_count_;
+    }
+}
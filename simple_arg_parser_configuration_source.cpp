@@ -0,0 +1,182 @@
+// Copyright 2025 arkanarian-a
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is furnished
+// to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include <cctype>
+#include <iterator>
+#include <algorithm>
+#include <cstring>
+#include "hpp/simple_arg_parser.hpp"
+
+extern char** environ; // <-- the process environment (POSIX)
+
+namespace SimpleArgParser
+{
+    ConfigurationSource ConfigurationSource::from_stream(std::string name, std::istream& is)
+    {
+        ConfigurationSource source{std::move(name)};
+        std::string text{std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>()};
+
+        for (std::string_view rest{text}, token{Internals_::next_configuration_token(rest)}; !token.empty(); token = Internals_::next_configuration_token(rest))
+            source.append_token_(token);
+
+        source.finish_tokens_();
+
+        return source;
+    }
+
+    ConfigurationSource ConfigurationSource::from_environment(std::string name, std::string_view prefix, const char* const* environment)
+    {
+        ConfigurationSource source{std::move(name)};
+
+        source.is_environment_ = true;
+
+        for (auto variable{environment ? environment : environ}; *variable; ++variable)
+        {
+            std::string_view definition{*variable};
+
+            auto delimiter_pos{definition.find('=')};
+
+            if (delimiter_pos == std::string_view::npos || delimiter_pos <= prefix.size() || !definition.starts_with(prefix))
+                continue;
+
+            std::string option_key{"--"};
+
+            for (auto name_char : definition.substr(prefix.size(), delimiter_pos - prefix.size()))
+                option_key.push_back(name_char == '_' ? '-' : static_cast<char>(std::tolower(static_cast<unsigned char>(name_char))));
+
+            Entry_ entry{source.tokens_.size(), 1};
+
+            source.append_token_(option_key);
+
+            for
+            (
+                std::string_view rest{definition.substr(delimiter_pos + 1)}, token{Internals_::next_configuration_token(rest)}
+            ;   !token.empty()
+            ;   token = Internals_::next_configuration_token(rest), ++entry.token_count
+            )
+                source.append_token_(token);
+
+            source.entries_.push_back(entry);
+        }
+
+        source.finish_tokens_();
+
+        return source;
+    }
+
+    ConfigurationSource ConfigurationSource::from_bound_environment(const Parser& parser, std::string name, const char* const* environment)
+    {
+        ConfigurationSource source{std::move(name)};
+
+        source.is_environment_ = true;
+
+        if (parser.environment_search_table_.empty())
+            return source;
+
+        for (auto variable{environment ? environment : environ}; *variable; ++variable)
+        {
+            auto* delimiter{std::strchr(*variable, '=')};
+
+            if (!delimiter)
+                continue;
+
+            bool is_single_token{false};
+            auto* option{parser.find_bound_option_({*variable, static_cast<std::size_t>(delimiter - *variable)}, is_single_token)};
+
+            // An empty scalar value (NAME=) stands for the variable unset, rather than for an empty token failing conversion:
+            if (!option || (is_single_token && delimiter[1] == '\0'))
+                continue;
+
+            Entry_ entry{source.tokens_.size(), 1};
+
+            source.append_token_(option->get_key());
+
+            if (is_single_token)
+            {
+                // The value is referred to in place:
+                source.tokens_.push_back(delimiter + 1);
+                ++entry.token_count;
+            }
+            else
+            {
+                for
+                (
+                    std::string_view rest{delimiter + 1}, token{Internals_::next_configuration_token(rest)}
+                ;   !token.empty()
+                ;   token = Internals_::next_configuration_token(rest), ++entry.token_count
+                )
+                    source.append_token_(token);
+            }
+
+            source.entries_.push_back(entry);
+        }
+
+        source.finish_tokens_();
+
+        return source;
+    }
+
+    ConfigurationSource ConfigurationSource::from_arguments(std::string name, int argc, const char* argv[])
+    {
+        ConfigurationSource source{std::move(name)};
+
+        if (argc > 1)
+            source.tokens_.assign(argv + 1, argv + argc);
+
+        return source;
+    }
+
+    void ConfigurationSource::append_token_(std::string_view token)
+    {
+        text_.insert(text_.end(), token.begin(), token.end());
+        text_.push_back('\0');
+
+        // The pointer is made when the text is complete (so it's not invalidated by the text growth):
+        tokens_.push_back(nullptr);
+    }
+
+    void ConfigurationSource::finish_tokens_()
+    {
+        for (auto token_ptr{text_.data()}; auto& token : tokens_)
+        {
+            if (token) continue;
+
+            token = token_ptr;
+            token_ptr+=std::char_traits<char>::length(token_ptr) + 1;
+        }
+    }
+
+    std::string_view Internals_::next_configuration_token(std::string_view& text)
+    {
+        auto is_space = [] (char c) { return std::isspace(static_cast<unsigned char>(c)) != 0; };
+
+        auto first{std::ranges::find_if_not(text, is_space)}, last{first};
+
+        for (char quote_mark{'\0'}; last != text.end() && (quote_mark || !is_space(*last)); ++last)
+        {
+            if (quote_mark ? *last == quote_mark : (*last == '"' || *last == '\''))
+                quote_mark = quote_mark ? '\0' : *last;
+        }
+
+        std::string_view token{first, last};
+
+        text.remove_prefix(last - text.begin());
+
+        return token;
+    }
+}
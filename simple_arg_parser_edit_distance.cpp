@@ -0,0 +1,115 @@
+// Copyright 2025 arkanarian-a
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is furnished
+// to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include <vector>
+#include <numeric>
+#include <algorithm>
+#include "hpp/simple_arg_parser_edit_distance.hpp"
+
+namespace SimpleArgParser::Internals_
+{
+    BoundedEditDistance::BoundedEditDistance(std::string_view pattern, std::size_t max_distance)
+    :   pattern_(pattern)
+    ,   max_distance_(max_distance)
+    {
+        if (pattern_.size() > WORD_BITS)
+            return;
+
+        for (std::size_t pattern_index{0}; pattern_index < pattern_.size(); ++pattern_index)
+            match_masks_[static_cast<unsigned char>(pattern_[pattern_index])]|=std::uint64_t{1} << pattern_index;
+    }
+
+    std::optional<std::size_t> BoundedEditDistance::operator()(std::string_view text) const
+    {
+        // The distance is at least the difference of the lengths:
+        auto length_difference{pattern_.size() > text.size() ? pattern_.size() - text.size() : text.size() - pattern_.size()};
+
+        if (length_difference > max_distance_)
+            return std::nullopt;
+
+        if (pattern_.empty())
+            return text.size();
+
+        return pattern_.size() > WORD_BITS ? compute_by_rows_(text) : compute_by_columns_(text);
+    }
+
+    std::optional<std::size_t> BoundedEditDistance::compute_by_columns_(std::string_view text) const
+    {
+        const std::uint64_t last_row_bit{std::uint64_t{1} << (pattern_.size() - 1)};
+
+        // Vertical deltas of the column (+1 and -1 by bits), starting with the first one (0, 1, 2, ...):
+        std::uint64_t positive_vertical{~std::uint64_t{0}};
+        std::uint64_t negative_vertical{0};
+        std::size_t distance{pattern_.size()};
+
+        for (std::size_t text_index{0}; text_index < text.size(); ++text_index)
+        {
+            auto match{match_masks_[static_cast<unsigned char>(text[text_index])]};
+            auto vertical_mask{match | negative_vertical};
+            auto horizontal_mask{(((match & positive_vertical) + positive_vertical) ^ positive_vertical) | match};
+            auto positive_horizontal{negative_vertical | ~(horizontal_mask | positive_vertical)};
+            auto negative_horizontal{positive_vertical & horizontal_mask};
+
+            if (positive_horizontal & last_row_bit)
+                ++distance;
+            else if (negative_horizontal & last_row_bit)
+                --distance;
+
+            // The distance decreases by one per text character left at most:
+            if (distance > max_distance_ + (text.size() - text_index - 1))
+                return std::nullopt;
+
+            // The first row of the matrix (the distances from the empty pattern) grows by one per column:
+            positive_horizontal = (positive_horizontal << 1) | 1;
+            negative_horizontal <<= 1;
+
+            positive_vertical = negative_horizontal | ~(vertical_mask | positive_horizontal);
+            negative_vertical = positive_horizontal & vertical_mask;
+        }
+
+        return distance <= max_distance_ ? std::optional{distance} : std::nullopt;
+    }
+
+    std::optional<std::size_t> BoundedEditDistance::compute_by_rows_(std::string_view text) const
+    {
+        std::vector<std::size_t> row(text.size() + 1);
+
+        std::iota(row.begin(), row.end(), std::size_t{0});
+
+        for (std::size_t pattern_index{0}; pattern_index < pattern_.size(); ++pattern_index)
+        {
+            auto diagonal{row[0]};
+
+            row[0] = pattern_index + 1;
+
+            for (std::size_t text_index{0}; text_index < text.size(); ++text_index)
+            {
+                auto substitution{diagonal + (pattern_[pattern_index] != text[text_index])};
+
+                diagonal = row[text_index + 1];
+                row[text_index + 1] = std::min({substitution, row[text_index] + 1, diagonal + 1});
+            }
+
+            // Every alignment passes each row at a cost which never decreases, so the row minimum bounds the distance:
+            if (*std::ranges::min_element(row) > max_distance_)
+                return std::nullopt;
+        }
+
+        return row.back() <= max_distance_ ? std::optional{row.back()} : std::nullopt;
+    }
+}
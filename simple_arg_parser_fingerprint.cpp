@@ -0,0 +1,179 @@
+// Copyright 2025 arkanarian-a
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is furnished
+// to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include <cstring>
+#include "hpp/simple_arg_parser_fingerprint.hpp"
+
+namespace SimpleArgParser
+{
+    namespace
+    {
+        constexpr std::uint64_t PRIME1{0x9E3779B185EBCA87};
+        constexpr std::uint64_t PRIME2{0xC2B2AE3D27D4EB4F};
+        constexpr std::uint64_t PRIME3{0x165667B19E3779F9};
+        constexpr std::uint64_t PRIME4{0x85EBCA77C2B2AE63};
+        constexpr std::uint64_t PRIME5{0x27D4EB2F165667C5};
+
+        constexpr std::uint64_t HIGH_HALF_SEED{0x9E3779B97F4A7C15};
+
+        std::uint64_t read_le(const std::byte* bytes, std::size_t size)
+        // Read an integer of little-endian byte order (regardless of the platform byte order)
+        {
+            std::uint64_t value{0};
+
+            for (std::size_t byte_index{size}; byte_index-- > 0;)
+                value = (value << 8) | std::to_integer<std::uint64_t>(bytes[byte_index]);
+
+            return value;
+        }
+
+        std::uint64_t round(std::uint64_t accumulator, std::uint64_t input)
+        {
+            return std::rotl(accumulator + input * PRIME2, 31) * PRIME1;
+        }
+
+        std::uint64_t merge_round(std::uint64_t hash, std::uint64_t accumulator)
+        {
+            return (hash ^ round(0, accumulator)) * PRIME1 + PRIME4;
+        }
+    }
+
+    Internals_::Xxh64::Xxh64(std::uint64_t seed)
+    :   accumulators_{seed + PRIME1 + PRIME2, seed + PRIME2, seed, seed - PRIME1}
+    ,   seed_(seed)
+    {}
+
+    void Internals_::Xxh64::update(const std::byte* bytes, std::size_t size)
+    {
+        total_size_+=size;
+
+        if (stripe_size_ + size < stripe_.size())
+        {
+            std::memcpy(stripe_.data() + stripe_size_, bytes, size);
+            stripe_size_+=size;
+
+            return;
+        }
+
+        auto consume_stripe = [this] (const std::byte* stripe)
+        {
+            for (std::size_t lane{0}; lane < accumulators_.size(); ++lane)
+                accumulators_[lane] = round(accumulators_[lane], read_le(stripe + lane * 8, 8));
+        };
+
+        if (stripe_size_)
+        {
+            auto fill_size{stripe_.size() - stripe_size_};
+
+            std::memcpy(stripe_.data() + stripe_size_, bytes, fill_size);
+            consume_stripe(stripe_.data());
+
+            bytes+=fill_size;
+            size-=fill_size;
+            stripe_size_ = 0;
+        }
+
+        for (; size >= stripe_.size(); bytes+=stripe_.size(), size-=stripe_.size())
+            consume_stripe(bytes);
+
+        std::memcpy(stripe_.data(), bytes, size);
+        stripe_size_ = size;
+    }
+
+    std::uint64_t Internals_::Xxh64::digest() const
+    {
+        std::uint64_t hash;
+
+        if (total_size_ >= stripe_.size())
+        {
+            auto& [v1, v2, v3, v4]{accumulators_};
+
+            hash = std::rotl(v1, 1) + std::rotl(v2, 7) + std::rotl(v3, 12) + std::rotl(v4, 18);
+
+            for (auto accumulator : accumulators_)
+                hash = merge_round(hash, accumulator);
+        }
+        else
+        {
+            hash = seed_ + PRIME5;
+        }
+
+        hash+=total_size_;
+
+        auto* bytes{stripe_.data()};
+        auto* bytes_end{bytes + stripe_size_};
+
+        for (; bytes_end - bytes >= 8; bytes+=8)
+            hash = std::rotl(hash ^ round(0, read_le(bytes, 8)), 27) * PRIME1 + PRIME4;
+
+        if (bytes_end - bytes >= 4)
+        {
+            hash = std::rotl(hash ^ (read_le(bytes, 4) * PRIME1), 23) * PRIME2 + PRIME3;
+            bytes+=4;
+        }
+
+        for (; bytes != bytes_end; ++bytes)
+            hash = std::rotl(hash ^ (std::to_integer<std::uint64_t>(*bytes) * PRIME5), 11) * PRIME1;
+
+        hash^=hash >> 33;
+        hash*=PRIME2;
+        hash^=hash >> 29;
+        hash*=PRIME3;
+        hash^=hash >> 32;
+
+        return hash;
+    }
+
+    FingerprintHasher::FingerprintHasher()
+    :   low_(0)
+    ,   high_(HIGH_HALF_SEED)
+    {}
+
+    void FingerprintHasher::update(const void* bytes, std::size_t size)
+    {
+        low_.update(static_cast<const std::byte*>(bytes), size);
+        high_.update(static_cast<const std::byte*>(bytes), size);
+    }
+
+    void FingerprintHasher::update_string(std::string_view string)
+    {
+        update_integer(static_cast<std::uint64_t>(string.size()));
+        update(string.data(), string.size());
+    }
+
+    Internals_::FingerprintStreamBuffer::int_type Internals_::FingerprintStreamBuffer::overflow(int_type c)
+    {
+        if (!traits_type::eq_int_type(c, traits_type::eof()))
+        {
+            auto character{traits_type::to_char_type(c)};
+
+            hasher_.update(&character, 1);
+            ++character_count_;
+        }
+
+        return traits_type::not_eof(c);
+    }
+
+    std::streamsize Internals_::FingerprintStreamBuffer::xsputn(const char* s, std::streamsize count)
+    {
+        hasher_.update(s, count);
+        character_count_+=count;
+
+        return count;
+    }
+}
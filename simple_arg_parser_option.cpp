@@ -44,6 +44,7 @@ namespace SimpleArgParser
     ,   value_(option.value_)
     ,   arg_parser_(option.arg_parser_)
     ,   io_handler_(option.io_handler_)
+    ,   instrumentation_(option.instrumentation_)
     {
         // The source Option object keeps in the io_handler_ the pointer to input/output handler which stay inconsistent
         // after its construction until explicit linking it to Option object it serves for.
@@ -93,25 +94,149 @@ namespace SimpleArgParser
         return is;
     }
 
-    void Option::link_to_(Parser* parser_ptr)
+    OptionStatistics Option::statistics() const
+    {
+        return instrumentation_.statistics();
+    }
+
+    bool Option::is_specified() const
+    {
+        return parser_ptr_ && parser_ptr_->specified_options_.test(ordinal_);
+    }
+
+    void Option::link_to_(Parser* parser_ptr, std::size_t ordinal)
     {
         parser_ptr_ = parser_ptr;
+        ordinal_ = ordinal;
     }
 
     bool Option::option_key_is_defined_(std::string_view option_key) const
     {
-        return parser_ptr_ && parser_ptr_->has_option(option_key);
+        return parser_ptr_ && parser_ptr_->terminates_option_value_(option_key);
+    }
+
+    bool Option::is_switch_() const
+    {
+        return arg_parser_ == &Option::set_switch_option_on_;
+    }
+
+    bool Option::switch_is_on_() const
+    {
+        return get_value<SwitchState>() == SwitchState::Specified;
+    }
+
+    bool Option::is_bound_switch_() const
+    {
+        return is_switch_() && std::any_cast<const Internals_::ScalarValue<SwitchState>&>(value_).refers_to_external_value();
+    }
+
+    std::size_t Option::count_value_tokens_(const SubrangeOfArgV_& subrange_of_argv, std::size_t max_token_count) const
+    {
+        std::size_t token_count{0};
+
+        for
+        (
+            auto arg{subrange_of_argv.begin()}
+        ;   arg != subrange_of_argv.end() && token_count < max_token_count && !option_key_is_defined_(*arg)
+        ;   ++arg
+        )
+            ++token_count;
+
+        return token_count;
+    }
+
+    std::size_t Option::count_value_span_(const SubrangeOfArgV_& subrange_of_argv) const
+    {
+        auto [item_token_count, max_items, is_vectored]{io_handler_->value_shape()};
+
+        if (item_token_count == 0)
+            return 0;
+
+        if (!is_vectored)
+            return std::min(item_token_count, subrange_of_argv.size());
+
+        if (item_token_count == 1)
+            return count_value_tokens_(subrange_of_argv, max_items);
+
+        // The same iteration as parse_argument_ performs for values represented by several tokens:
+        std::size_t args_consumed{0}, max_args_to_consume{max_items * item_token_count};
+
+        for (auto arg{subrange_of_argv.begin()}; arg != subrange_of_argv.end() && !option_key_is_defined_(*arg) && args_consumed < max_args_to_consume;)
+        {
+            auto arg_items_num{std::min(item_token_count, static_cast<std::size_t>(subrange_of_argv.end() - arg))};
+
+            arg+=arg_items_num;
+            args_consumed+=arg_items_num;
+        }
+
+        return args_consumed;
+    }
+
+    std::size_t Option::conversion_chunk_size_() const
+    {
+        return parser_ptr_ && parser_ptr_->conversion_pool_ ? parser_ptr_->conversion_chunk_size_ : 0;
+    }
+
+    void Option::run_conversion_chunks_(std::size_t chunk_count, const std::function<void(std::size_t)>& convert_chunk)
+    {
+        std::vector<std::exception_ptr> chunk_exceptions(chunk_count);
+
+        parser_ptr_->conversion_pool_->run
+        (
+            chunk_count
+        ,   [&] (std::size_t chunk_index)
+            {
+                try
+                {
+                    convert_chunk(chunk_index);
+                }
+                catch (...)
+                {
+                    chunk_exceptions[chunk_index] = std::current_exception();
+                }
+            }
+        );
+
+        for (const auto& chunk_exception : chunk_exceptions)
+            if (chunk_exception) std::rethrow_exception(chunk_exception);
+    }
+
+    void Option::defer_input_(std::function<std::optional<std::string>()>&& input)
+    {
+        parser_ptr_->defer_input_(this, argument_position_, std::move(input));
+    }
+
+    void Option::discard_deferred_inputs_()
+    {
+        parser_ptr_->discard_deferred_inputs_(this);
     }
 
     int Option::parse_option_argument_(SubrangeOfArgV_& subrange_of_argv)
     {
-        return (this->*arg_parser_)(subrange_of_argv);
+        try
+        {
+            Internals_::Stopwatch stopwatch;
+
+            auto args_consumed{(this->*arg_parser_)(subrange_of_argv)};
+
+            instrumentation_.record_conversion(args_consumed - 1, stopwatch);
+
+            return args_consumed;
+        }
+        catch (...)
+        {
+            instrumentation_.record_exception();
+
+            throw;
+        }
     }
 
     int Option::set_switch_option_on_(SubrangeOfArgV_&)
     {
         get_value_<SwitchState>() = Specified;
 
+        instrumentation_.record_items(1, 0, 0);
+
         return 1;
     };
 
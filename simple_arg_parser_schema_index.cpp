@@ -0,0 +1,135 @@
+// Copyright 2025 arkanarian-a
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is furnished
+// to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include <cerrno>
+#include <cstring>
+#include <utility>
+#include <algorithm>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "hpp/simple_arg_parser_schema_index.hpp"
+#include "hpp/simple_arg_parser_exceptions.hpp"
+
+namespace SimpleArgParser
+{
+    SchemaIndex::SchemaIndex(SchemaIndex&& other) noexcept
+    :   base_(std::exchange(other.base_, nullptr))
+    ,   size_(std::exchange(other.size_, 0))
+    ,   entries_(other.entries_)
+    ,   entry_count_(other.entry_count_)
+    ,   strings_(other.strings_)
+    {}
+
+    SchemaIndex::~SchemaIndex()
+    {
+        if (base_)
+            munmap(const_cast<std::byte*>(base_), size_);
+    }
+
+    SchemaIndex SchemaIndex::open(const char* index_path)
+    {
+        auto index_fd{::open(index_path, O_RDONLY | O_CLOEXEC)};
+
+        if (index_fd == -1)
+            throw SchemaIndexException::IndexFileFailure(index_path, "open", std::strerror(errno), std::source_location::current());
+
+        struct stat index_stat;
+        void* mapping{MAP_FAILED};
+
+        if (fstat(index_fd, &index_stat) == 0 && static_cast<std::size_t>(index_stat.st_size) >= sizeof(Header_))
+            mapping = mmap(nullptr, index_stat.st_size, PROT_READ, MAP_PRIVATE, index_fd, 0);
+
+        auto error{errno};
+
+        close(index_fd);
+
+        if (mapping == MAP_FAILED)
+            throw SchemaIndexException::IndexFileFailure(index_path, "mmap", std::strerror(error), std::source_location::current());
+
+        SchemaIndex index{static_cast<const std::byte*>(mapping), static_cast<std::size_t>(index_stat.st_size)};
+
+        Header_ header;
+
+        std::memcpy(&header, index.base_, sizeof(header));
+
+        bool is_valid
+        {
+            std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) == 0
+        &&  header.layout_version == LAYOUT_VERSION
+        &&  header.size == index.size_
+        &&  header.strings_offset >= sizeof(Header_) + header.entry_count * sizeof(EntryRecord)
+        &&  header.strings_offset <= index.size_
+        };
+
+        if (is_valid)
+        {
+            index.entries_ = reinterpret_cast<const EntryRecord*>(index.base_ + sizeof(Header_));
+            index.entry_count_ = header.entry_count;
+            index.strings_ = reinterpret_cast<const char*>(index.base_ + header.strings_offset);
+
+            // The records are validated once here, so the accessors don't check the offsets:
+            auto fits = [strings_size{index.size_ - header.strings_offset}] (std::uint64_t offset, std::uint64_t size)
+            {
+                return offset + size <= strings_size;
+            };
+
+            for (const auto& record : index.entries())
+            {
+                is_valid = is_valid
+                &&  fits(record.key_offset, record.key_size)
+                &&  fits(record.canonical_key_offset, record.canonical_key_size)
+                &&  fits(record.description_offset, record.description_size);
+            }
+        }
+
+        if (!is_valid)
+            throw SchemaIndexException::IndexLayoutMismatch(index_path, std::source_location::current());
+
+        return index;
+    }
+
+    std::span<const SchemaIndex::EntryRecord> SchemaIndex::complete(std::string_view prefix) const
+    {
+        auto record_key = [this] (const EntryRecord& record) { return key(record); };
+
+        // The keys starting with the prefix follow each other, since the records are sorted:
+        auto first{std::ranges::lower_bound(entries(), prefix, {}, record_key)};
+        auto last{std::ranges::partition_point(std::span{first, entries().end()}, [&] (const EntryRecord& record) { return key(record).starts_with(prefix); })};
+
+        return {first, last};
+    }
+
+    std::size_t SchemaIndex::output_completions(std::string_view prefix, std::ostream& os, bool with_descriptions) const
+    {
+        auto records{complete(prefix)};
+
+        for (const auto& record : records)
+        {
+            os << key(record);
+
+            if (with_descriptions && record.description_size)
+                os << '\t' << description(record);
+
+            os << '\n';
+        }
+
+        return records.size();
+    }
+}
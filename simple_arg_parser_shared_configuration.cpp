@@ -0,0 +1,310 @@
+// Copyright 2025 arkanarian-a
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is furnished
+// to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include <bit>
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "hpp/simple_arg_parser.hpp"
+
+namespace SimpleArgParser
+{
+    namespace
+    {
+        constexpr std::size_t ALIGNMENT{Internals_::IOptionIO::VALUE_IMAGE_ALIGNMENT};
+
+        std::size_t align(std::size_t offset)
+        {
+            return (offset + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+        }
+
+        std::atomic_ref<std::uint64_t> magic_word(const std::byte* base)
+        // The magic (the first word of the segment) is accessed atomically, since publish() writes it last to mark the
+        // segment complete (the segment is mapped at a page boundary, so the word is aligned).
+        {
+            return std::atomic_ref<std::uint64_t>{*reinterpret_cast<std::uint64_t*>(const_cast<std::byte*>(base))};
+        }
+    }
+
+    SharedConfiguration::SharedConfiguration(SharedConfiguration&& other) noexcept
+    :   base_(std::exchange(other.base_, nullptr))
+    ,   size_(std::exchange(other.size_, 0))
+    {}
+
+    SharedConfiguration::~SharedConfiguration()
+    {
+        if (base_)
+            munmap(const_cast<std::byte*>(base_), size_);
+    }
+
+    void SharedConfiguration::publish(const Parser& parser, const std::string& segment_name, unsigned int mode)
+    {
+        const auto& options{parser.options_};
+
+        // Sizing pass:
+        std::vector<std::pair<std::string_view, std::uint32_t>> keys; // <-- keys and aliases with option ordinals
+        std::vector<Internals_::IOptionIO::ValueImage> value_images;
+        std::size_t key_characters_size{0};
+
+        value_images.reserve(options.size());
+
+        for (std::uint32_t ordinal{0}; const auto& option : options)
+        {
+            keys.emplace_back(option.get_key(), ordinal);
+
+            if (option.attributes_.alias_key.has_value())
+                keys.emplace_back(option.attributes_.alias_key.value(), ordinal);
+
+            if (option.is_switch_())
+                value_images.push_back({ValueImageKind::Switch});
+            else
+                value_images.push_back(option.io_handler_->value_image());
+
+            ++ordinal;
+        }
+
+        std::ranges::sort(keys);
+
+        for (auto [key, ordinal] : keys)
+            key_characters_size+=key.size();
+
+        Header_ header{};   // <-- the magic is left zero until the segment is filled
+
+        header.layout_version = LAYOUT_VERSION;
+        header.option_count = options.size();
+        header.key_count = keys.size();
+        header.entries_offset = align(sizeof(Header_));
+        header.key_records_offset = align(header.entries_offset + options.size() * sizeof(Entry_));
+
+        auto key_characters_offset{header.key_records_offset + keys.size() * sizeof(KeyRecord_)};
+        std::vector<std::uint64_t> value_offsets;
+
+        value_offsets.reserve(value_images.size());
+        header.segment_size = key_characters_offset + key_characters_size;
+
+        for (const auto& value_image : value_images)
+        {
+            value_offsets.push_back(align(header.segment_size));
+            header.segment_size = value_offsets.back() + value_image.size;
+        }
+
+        // The segment of the same name is unlinked (not truncated), since the processes having it mapped would fail otherwise:
+        shm_unlink(segment_name.c_str());
+
+        auto segment_fd{shm_open(segment_name.c_str(), O_CREAT | O_EXCL | O_RDWR, mode)};
+
+        if (segment_fd == -1)
+            throw SharedConfigurationException::SegmentOperationFailure(segment_name, "shm_open", std::strerror(errno), std::source_location::current());
+
+        void* segment{MAP_FAILED};
+
+        if (ftruncate(segment_fd, header.segment_size) == 0)
+            segment = mmap(nullptr, header.segment_size, PROT_READ | PROT_WRITE, MAP_SHARED, segment_fd, 0);
+
+        if (segment == MAP_FAILED)
+        {
+            auto error{errno};
+
+            close(segment_fd);
+            shm_unlink(segment_name.c_str());
+
+            throw SharedConfigurationException::SegmentOperationFailure(segment_name, "mmap", std::strerror(error), std::source_location::current());
+        }
+
+        close(segment_fd);
+
+        // Filling pass (the segment is zero-filled by ftruncate, and the header is written without the magic first):
+        auto* base{static_cast<std::byte*>(segment)};
+
+        std::memcpy(base, &header, sizeof(header));
+
+        for (std::size_t key_index{0}, key_offset{key_characters_offset}; key_index < keys.size(); ++key_index)
+        {
+            auto [key, ordinal]{keys[key_index]};
+            KeyRecord_ key_record{key_offset, static_cast<std::uint32_t>(key.size()), ordinal};
+
+            std::memcpy(base + header.key_records_offset + key_index * sizeof(KeyRecord_), &key_record, sizeof(key_record));
+            std::memcpy(base + key_offset, key.data(), key.size());
+            key_offset+=key.size();
+        }
+
+        for (std::uint32_t ordinal{0}; const auto& option : options)
+        {
+            const auto& value_image{value_images[ordinal]};
+            Entry_ entry
+            {
+                value_image.item_type ? type_hash_(value_image.item_type->name()) : 0
+            ,   value_offsets[ordinal]
+            ,   value_image.item_count
+            ,   static_cast<std::uint32_t>(value_image.item_size)
+            ,   value_image.kind
+            ,   option.io_handler_->value_shape().is_vectored
+            ,   parser.specified_options_.test(ordinal)
+            ,   value_image.kind == ValueImageKind::Switch && parser.output_switch_state_(ordinal)
+            };
+
+            if (value_image.kind == ValueImageKind::Trivial || value_image.kind == ValueImageKind::Strings)
+                option.io_handler_->value_image(base + entry.value_offset);
+
+            std::memcpy(base + header.entries_offset + ordinal * sizeof(Entry_), &entry, sizeof(entry));
+
+            ++ordinal;
+        }
+
+        // The segment is visible by its name while being filled, so the magic is written last (by a release store) and
+        // a process attaching the segment half-built fails its validation:
+        static_assert(offsetof(Header_, magic) == 0 && sizeof(MAGIC) == sizeof(std::uint64_t));
+
+        magic_word(base).store(std::bit_cast<std::uint64_t>(MAGIC), std::memory_order_release);
+
+        munmap(segment, header.segment_size);
+    }
+
+    SharedConfiguration SharedConfiguration::attach(const std::string& segment_name)
+    {
+        auto segment_fd{shm_open(segment_name.c_str(), O_RDONLY, 0)};
+
+        if (segment_fd == -1)
+            throw SharedConfigurationException::SegmentOperationFailure(segment_name, "shm_open", std::strerror(errno), std::source_location::current());
+
+        struct stat segment_stat;
+        void* segment{MAP_FAILED};
+
+        if (fstat(segment_fd, &segment_stat) == 0 && static_cast<std::size_t>(segment_stat.st_size) >= sizeof(Header_))
+            segment = mmap(nullptr, segment_stat.st_size, PROT_READ, MAP_SHARED, segment_fd, 0);
+
+        auto error{errno};
+
+        close(segment_fd);
+
+        if (segment == MAP_FAILED)
+            throw SharedConfigurationException::SegmentOperationFailure(segment_name, "mmap", std::strerror(error), std::source_location::current());
+
+        SharedConfiguration configuration{static_cast<const std::byte*>(segment), static_cast<std::size_t>(segment_stat.st_size)};
+
+        // The layout is validated once here, so the accessors don't check the offsets:
+        auto fits = [&configuration] (std::uint64_t offset, std::uint64_t size) { return offset <= configuration.size_ && size <= configuration.size_ - offset; };
+
+        const auto& header{configuration.header_()};
+
+        bool is_valid
+        {
+            // The magic is read first (by an acquire load), so the rest of the segment is read after it's complete:
+            magic_word(configuration.base_).load(std::memory_order_acquire) == std::bit_cast<std::uint64_t>(MAGIC)
+        &&  header.layout_version == LAYOUT_VERSION
+        &&  header.segment_size == configuration.size_
+        &&  fits(header.entries_offset, header.option_count * sizeof(Entry_))
+        &&  fits(header.key_records_offset, header.key_count * sizeof(KeyRecord_))
+        };
+
+        auto* key_records{reinterpret_cast<const KeyRecord_*>(configuration.base_ + header.key_records_offset)};
+        auto* entries{reinterpret_cast<const Entry_*>(configuration.base_ + header.entries_offset)};
+
+        for (std::size_t key_index{0}; is_valid && key_index < header.key_count; ++key_index)
+            is_valid = fits(key_records[key_index].key_offset, key_records[key_index].key_size) && key_records[key_index].ordinal < header.option_count;
+
+        for (std::size_t ordinal{0}; is_valid && ordinal < header.option_count; ++ordinal)
+        {
+            const auto& entry{entries[ordinal]};
+
+            if (entry.kind == ValueImageKind::Trivial)
+            {
+                is_valid = entry.item_count <= configuration.size_ && fits(entry.value_offset, entry.item_count * entry.item_size);
+            }
+            else if (entry.kind == ValueImageKind::Strings)
+            {
+                is_valid = entry.item_count <= configuration.size_ && fits(entry.value_offset, entry.item_count * sizeof(Internals_::IOptionIO::StringImage));
+
+                for (std::size_t item_index{0}; is_valid && item_index < entry.item_count; ++item_index)
+                {
+                    Internals_::IOptionIO::StringImage string_image;
+
+                    std::memcpy(&string_image, configuration.base_ + entry.value_offset + item_index * sizeof(string_image), sizeof(string_image));
+                    is_valid = fits(entry.value_offset, string_image.offset) && fits(entry.value_offset + string_image.offset, string_image.size);
+                }
+            }
+        }
+
+        if (!is_valid)
+            throw SharedConfigurationException::SegmentLayoutMismatch(segment_name, std::source_location::current());
+
+        return configuration;
+    }
+
+    void SharedConfiguration::remove(const std::string& segment_name)
+    {
+        if (shm_unlink(segment_name.c_str()) == -1 && errno != ENOENT)
+            throw SharedConfigurationException::SegmentOperationFailure(segment_name, "shm_unlink", std::strerror(errno), std::source_location::current());
+    }
+
+    std::size_t SharedConfiguration::item_count(std::string_view option_key) const
+    {
+        return entry_(option_key).item_count;
+    }
+
+    bool SharedConfiguration::is_specified(std::string_view option_key) const
+    {
+        return entry_(option_key).is_specified;
+    }
+
+    bool SharedConfiguration::switch_is_on(std::string_view option_key) const
+    {
+        const auto& entry{entry_(option_key)};
+
+        if (entry.kind != ValueImageKind::Switch)
+            throw OptionAccessException::AccessingValueTypeMismatch{std::source_location::current()};
+
+        return entry.is_switch_on;
+    }
+
+    std::uint64_t SharedConfiguration::type_hash_(std::string_view type_name)
+    {
+        // FNV-1a (stable across processes, unlike std::type_info::hash_code()):
+        std::uint64_t hash{0xcbf29ce484222325};
+
+        for (auto name_char : type_name)
+            hash = (hash ^ static_cast<unsigned char>(name_char)) * 0x100000001b3;
+
+        return hash;
+    }
+
+    const SharedConfiguration::Entry_& SharedConfiguration::entry_(std::string_view option_key) const
+    {
+        const auto& header{header_()};
+        std::span key_records{reinterpret_cast<const KeyRecord_*>(base_ + header.key_records_offset), header.key_count};
+
+        auto record_key = [this] (const KeyRecord_& key_record)
+        {
+            return std::string_view{reinterpret_cast<const char*>(base_ + key_record.key_offset), key_record.key_size};
+        };
+
+        auto found{std::ranges::lower_bound(key_records, option_key, {}, record_key)};
+
+        if (found == key_records.end() || record_key(*found) != option_key)
+            throw OptionAccessException::UndeclaredOptionOrWrongOptionKey(option_key, std::source_location::current());
+
+        return reinterpret_cast<const Entry_*>(base_ + header.entries_offset)[found->ordinal];
+    }
+}
@@ -0,0 +1,126 @@
+// Copyright 2025 arkanarian-a
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is furnished
+// to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include <algorithm>
+#include "hpp/simple_arg_parser_thread_pool.hpp"
+
+namespace SimpleArgParser::Internals_
+{
+    ThreadPool::ThreadPool(std::size_t worker_count)
+    {
+        if (worker_count == 0)
+            worker_count = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+
+        workers_.reserve(worker_count);
+
+        for (std::size_t worker_index{0}; worker_index < worker_count; ++worker_index)
+            workers_.emplace_back(&ThreadPool::work_, this);
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        {
+            std::lock_guard lock{mutex_};
+
+            stopping_ = true;
+        }
+
+        work_available_.notify_all();
+
+        for (auto& worker : workers_)
+            worker.join();
+    }
+
+    void ThreadPool::run(std::size_t task_count, const Task& task)
+    {
+        if (task_count == 0)
+            return;
+
+        Batch_ batch{&task, task_count};
+
+        if (task_count > 1)
+        {
+            {
+                std::lock_guard lock{mutex_};
+
+                batches_.push_back(&batch);
+            }
+
+            work_available_.notify_all();
+        }
+
+        for (auto task_index{batch.next_index.fetch_add(1)}; task_index < task_count; task_index = batch.next_index.fetch_add(1))
+            run_task_(batch, task_index);
+
+        std::unique_lock lock{mutex_};
+
+        // The batch may still be queued if the calling thread has taken its last task (the workers never see it then):
+        if (auto queued{std::find(batches_.begin(), batches_.end(), &batch)}; queued != batches_.end())
+            batches_.erase(queued);
+
+        batch_completed_.wait(lock, [&batch] { return batch.completed_count.load() == batch.task_count; });
+    }
+
+    void ThreadPool::run_task_(Batch_& batch, std::size_t task_index)
+    {
+        // NOTE: the batch MUST NOT be touched after the completion is counted, since its owner may destroy it then
+        // (once the other tasks complete), so the task count is read before:
+        auto task_count{batch.task_count};
+
+        (*batch.task)(task_index);
+
+        if (batch.completed_count.fetch_add(1) + 1 == task_count)
+        {
+            // Lock to avoid the notification being lost between the waiter's predicate check and its wait:
+            std::lock_guard lock{mutex_};
+
+            batch_completed_.notify_all();
+        }
+    }
+
+    void ThreadPool::work_()
+    {
+        std::unique_lock lock{mutex_};
+
+        while (true)
+        {
+            work_available_.wait(lock, [this] { return stopping_ || !batches_.empty(); });
+
+            if (stopping_)
+                return;
+
+            // The task index is claimed under the lock, so the batch can't be dequeued and destroyed by its owner meanwhile:
+            auto* batch{batches_.front()};
+            auto task_index{batch->next_index.fetch_add(1)};
+
+            if (task_index >= batch->task_count)
+            {
+                // All the tasks of the batch are started, so it's dequeued (its owner waits for their completion):
+                batches_.pop_front();
+
+                continue;
+            }
+
+            lock.unlock();
+
+            run_task_(*batch, task_index);
+
+            lock.lock();
+        }
+    }
+}